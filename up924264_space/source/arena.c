@@ -0,0 +1,33 @@
+#include <gba_base.h>	// for EWRAM_BSS
+#include "arena.h"
+#include "debug.h"
+
+EWRAM_BSS static uint32 arenaMemory[ARENA_SIZE / 4]; // uint32 keeps it word aligned
+static uint32 arenaUsed = 0;
+static uint32 arenaHighWater = 0;
+
+void* arenaAlloc(uint32 size)
+{
+	void* block;
+
+	size = (size + 3) & ~3;
+	if (size > ARENA_SIZE - arenaUsed)
+	{
+		debugPrintHex("arena full, asked for ", size);
+		return 0;
+	}
+
+	block = (uint8*)arenaMemory + arenaUsed;
+	arenaUsed += size;
+	if (arenaUsed > arenaHighWater)
+	{
+		arenaHighWater = arenaUsed;
+	}
+	return block;
+}
+
+void arenaReport(void)
+{
+	debugPrintHex("arena used ", arenaUsed);
+	debugPrintHex("arena high water ", arenaHighWater);
+}
@@ -0,0 +1,12 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include "types.h"
+
+#define ARENA_SIZE (128 * 1024) // half of ewram
+
+// the arena hands out memory by moving a pointer along, for buffers that last the whole game
+void* arenaAlloc(uint32 size); // 4 byte aligned, null if the arena is full
+void arenaReport(void); // prints the usage and high water mark to the debug output
+
+#endif
@@ -0,0 +1,48 @@
+#include "debug.h"
+
+static volatile uint16* const DEBUG_ENABLE = (volatile uint16*)0x4FFF780; // mGBA debug registers
+static volatile uint16* const DEBUG_FLAGS = (volatile uint16*)0x4FFF700;
+static volatile char* const DEBUG_STRING = (volatile char*)0x4FFF600;
+
+#define DEBUG_LEVEL_INFO 3
+#define DEBUG_MAX_LENGTH 256
+
+void debugPrint(const char* text)
+{
+	uint16 i;
+
+	DEBUG_ENABLE[0] = 0xC0DE;
+	if (DEBUG_ENABLE[0] != 0x1DEA) // not running in mGBA
+	{
+		return;
+	}
+
+	for (i = 0; i < DEBUG_MAX_LENGTH - 1 && text[i]; i++)
+	{
+		DEBUG_STRING[i] = text[i];
+	}
+	DEBUG_STRING[i] = 0;
+	DEBUG_FLAGS[0] = (DEBUG_LEVEL_INFO | (1 << 8)); // level | send
+}
+
+void debugPrintHex(const char* label, uint32 value)
+{
+	char text[DEBUG_MAX_LENGTH];
+	uint16 i = 0;
+	int shift;
+
+	while (label[i] && i < DEBUG_MAX_LENGTH - 11)
+	{
+		text[i] = label[i];
+		i++;
+	}
+	text[i++] = '0';
+	text[i++] = 'x';
+	for (shift = 28; shift >= 0; shift -= 4)
+	{
+		text[i++] = "0123456789ABCDEF"[(value >> shift) & 15];
+	}
+	text[i] = 0;
+
+	debugPrint(text);
+}
@@ -0,0 +1,10 @@
+#ifndef DEBUG_H
+#define DEBUG_H
+
+#include "types.h"
+
+// messages go to the mGBA log window, on hardware they are ignored
+void debugPrint(const char* text);
+void debugPrintHex(const char* label, uint32 value); // prints label followed by the value in hex
+
+#endif
@@ -0,0 +1,145 @@
+#include "fixmath.h"
+
+// sin of every angle, 1.0 is FIX_ONE
+static const short sinTable[256] = {
+	0, 6, 13, 19, 25, 31, 38, 44, 50, 56, 62, 68, 74, 80, 86, 92,
+	98, 104, 109, 115, 121, 126, 132, 137, 142, 147, 152, 157, 162, 167, 172, 177,
+	181, 185, 190, 194, 198, 202, 206, 209, 213, 216, 220, 223, 226, 229, 231, 234,
+	237, 239, 241, 243, 245, 247, 248, 250, 251, 252, 253, 254, 255, 255, 256, 256,
+	256, 256, 256, 255, 255, 254, 253, 252, 251, 250, 248, 247, 245, 243, 241, 239,
+	237, 234, 231, 229, 226, 223, 220, 216, 213, 209, 206, 202, 198, 194, 190, 185,
+	181, 177, 172, 167, 162, 157, 152, 147, 142, 137, 132, 126, 121, 115, 109, 104,
+	98, 92, 86, 80, 74, 68, 62, 56, 50, 44, 38, 31, 25, 19, 13, 6,
+	0, -6, -13, -19, -25, -31, -38, -44, -50, -56, -62, -68, -74, -80, -86, -92,
+	-98, -104, -109, -115, -121, -126, -132, -137, -142, -147, -152, -157, -162, -167, -172, -177,
+	-181, -185, -190, -194, -198, -202, -206, -209, -213, -216, -220, -223, -226, -229, -231, -234,
+	-237, -239, -241, -243, -245, -247, -248, -250, -251, -252, -253, -254, -255, -255, -256, -256,
+	-256, -256, -256, -255, -255, -254, -253, -252, -251, -250, -248, -247, -245, -243, -241, -239,
+	-237, -234, -231, -229, -226, -223, -220, -216, -213, -209, -206, -202, -198, -194, -190, -185,
+	-181, -177, -172, -167, -162, -157, -152, -147, -142, -137, -132, -126, -121, -115, -109, -104,
+	-98, -92, -86, -80, -74, -68, -62, -56, -50, -44, -38, -31, -25, -19, -13, -6
+};
+
+// atan of 0/32 to 32/32 as an angle * 16, for the first octant of fixAtan2()
+static const uint16 atanTable[33] = {
+	0, 20, 41, 61, 81, 101, 121, 140, 160, 179, 197,
+	216, 234, 252, 269, 286, 302, 318, 334, 349, 364, 379,
+	393, 406, 419, 432, 445, 457, 469, 480, 491, 502, 512
+};
+
+// 65536 / n, dividing by n becomes a multiply by recipTable[n] and a shift
+static const uint32 recipTable[256] = {
+	0, 65536, 32768, 21845, 16384, 13107, 10922, 9362, 8192, 7281, 6553, 5957, 5461, 5041, 4681, 4369,
+	4096, 3855, 3640, 3449, 3276, 3120, 2978, 2849, 2730, 2621, 2520, 2427, 2340, 2259, 2184, 2114,
+	2048, 1985, 1927, 1872, 1820, 1771, 1724, 1680, 1638, 1598, 1560, 1524, 1489, 1456, 1424, 1394,
+	1365, 1337, 1310, 1285, 1260, 1236, 1213, 1191, 1170, 1149, 1129, 1110, 1092, 1074, 1057, 1040,
+	1024, 1008, 992, 978, 963, 949, 936, 923, 910, 897, 885, 873, 862, 851, 840, 829,
+	819, 809, 799, 789, 780, 771, 762, 753, 744, 736, 728, 720, 712, 704, 697, 689,
+	682, 675, 668, 661, 655, 648, 642, 636, 630, 624, 618, 612, 606, 601, 595, 590,
+	585, 579, 574, 569, 564, 560, 555, 550, 546, 541, 537, 532, 528, 524, 520, 516,
+	512, 508, 504, 500, 496, 492, 489, 485, 481, 478, 474, 471, 468, 464, 461, 458,
+	455, 451, 448, 445, 442, 439, 436, 434, 431, 428, 425, 422, 420, 417, 414, 412,
+	409, 407, 404, 402, 399, 397, 394, 392, 390, 387, 385, 383, 381, 378, 376, 374,
+	372, 370, 368, 366, 364, 362, 360, 358, 356, 354, 352, 350, 348, 346, 344, 343,
+	341, 339, 337, 336, 334, 332, 330, 329, 327, 326, 324, 322, 321, 319, 318, 316,
+	315, 313, 312, 310, 309, 307, 306, 304, 303, 302, 300, 299, 297, 296, 295, 293,
+	292, 291, 289, 288, 287, 286, 284, 283, 282, 281, 280, 278, 277, 276, 275, 274,
+	273, 271, 270, 269, 268, 267, 266, 265, 264, 263, 262, 261, 260, 259, 258, 257
+};
+
+fixed fixSin(uint8 angle)
+{
+	return sinTable[angle];
+}
+
+fixed fixCos(uint8 angle)
+{
+	return sinTable[(uint8)(angle + 64)];
+}
+
+// looks up 65536 / d. big divisors are shifted down to fit the table first, and that
+// shift is passed back so the caller can take it off the result again
+static uint32 recip(uint32 d, uint16* shift)
+{
+	uint16 s = 0;
+	while (d > 255)
+	{
+		d >>= 1;
+		s++;
+	}
+	*shift = s;
+	return recipTable[d];
+}
+
+fixed fixDiv(fixed a, fixed b)
+{
+	uint16 shift;
+	uint32 r;
+	if (b == 0)
+	{
+		return 0;
+	}
+	r = recip(FIX_ABS(b), &shift);
+	a = (fixed)(((long long)a * r) >> (16 - FIX_SHIFT + shift)); // 64 bit product, a single smull on the arm7
+	return b < 0 ? -a : a;
+}
+
+uint8 fixAtan2(fixed y, fixed x)
+{
+	fixed ax = FIX_ABS(x);
+	fixed ay = FIX_ABS(y);
+	fixed big = ax > ay ? ax : ay;
+	fixed small = ax > ay ? ay : ax;
+	uint16 shift;
+	uint32 ratio;
+	uint16 angle;
+
+	if (big == 0)
+	{
+		return 0;
+	}
+
+	// small / big is between 0 and 1, as a number from 0 to 256
+	ratio = (small * recip(big, &shift)) >> (8 + shift);
+	if (ratio > 256)
+	{
+		ratio = 256;
+	}
+	angle = atanTable[ratio >> 3];
+	if (ratio < 256)
+	{
+		angle += ((atanTable[(ratio >> 3) + 1] - angle) * (ratio & 7)) >> 3;
+	}
+	angle = (angle + 8) >> 4;
+
+	// fold the first octant back out to the full circle
+	if (ay > ax)
+	{
+		angle = 64 - angle;
+	}
+	if (x < 0)
+	{
+		angle = 128 - angle;
+	}
+	if (y < 0)
+	{
+		angle = 256 - angle;
+	}
+	return (uint8)angle;
+}
+
+void fixNormalize(fixed* x, fixed* y)
+{
+	fixed ax = FIX_ABS(*x);
+	fixed ay = FIX_ABS(*y);
+	fixed big = ax > ay ? ax : ay;
+	fixed small = ax > ay ? ay : ax;
+	fixed length = big + (small >> 2) + (small >> 3); // big + 3/8 small, within about 7% of the real length
+
+	if (length == 0)
+	{
+		return;
+	}
+	*x = fixDiv(*x, length);
+	*y = fixDiv(*y, length);
+}
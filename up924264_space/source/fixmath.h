@@ -0,0 +1,25 @@
+#ifndef FIXMATH_H
+#define FIXMATH_H
+
+#include "types.h"
+
+// fixed point numbers with 8 fractional bits. the arm7 has no divide instruction, so
+// everything here is done with table lookups, multiplies and shifts instead of / and %
+typedef int fixed;
+
+#define FIX_SHIFT 8
+#define FIX_ONE (1 << FIX_SHIFT)
+#define INT_TO_FIX(n) ((n) * FIX_ONE) // a multiply so negative numbers are fine, it still compiles to a shift
+#define FIX_TO_INT(f) ((f) >> FIX_SHIFT)
+#define FIX_MUL(a, b) (((a) * (b)) >> FIX_SHIFT)
+#define FIX_ABS(f) ((f) < 0 ? -(f) : (f))
+
+// angles go from 0 to 255 for a full turn, with y pointing down the screen like sprite positions
+fixed fixSin(uint8 angle);
+fixed fixCos(uint8 angle);
+uint8 fixAtan2(fixed y, fixed x);
+
+fixed fixDiv(fixed a, fixed b); // a / b through the reciprocal table, good to about 1% as long as the answer fits in a fixed
+void fixNormalize(fixed* x, fixed* y); // scales the vector to a length of roughly FIX_ONE
+
+#endif
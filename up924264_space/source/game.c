@@ -0,0 +1,468 @@
+#include "game.h"
+
+typedef struct Collision // structure to hold positional variables for calculating collisions
+{
+	uint16 x11;
+	uint16 y11;
+	uint16 x21;
+	uint16 y21;
+	uint16 x31;
+	uint16 y31;
+	uint16 x41;
+	uint16 y41;
+	uint16 x51;
+	uint16 y51;
+	uint16 x61;
+	uint16 y61;
+	uint16 x12;
+	uint16 y12;
+	uint16 x22;
+	uint16 y22;
+	uint16 x32;
+	uint16 y32;
+	uint16 x42;
+	uint16 y42;
+	uint16 x52;
+	uint16 y52;
+	uint16 x62;
+	uint16 y62;
+
+} Collision;
+
+extern void collFunction(void* c);
+
+// random numbers are kept in the game state so a game can be replayed from its seed
+static uint16 gameRandom(GameState* game)
+{
+	game->seed = (game->seed * 1664525) + 1013904223;
+	return (game->seed >> 16) & 0x7FFF;
+}
+
+void gameInit(GameState* game, uint32 seed)
+{
+	game->seed = seed;
+	game->frame = 0;
+	game->gameOver = false;
+
+	game->score = 0;
+	game->scoreTimer = 0;
+
+	// display initial score
+	game->scoreMap[0] = ((9 << 0) | (3 << 12));
+	game->scoreMap[1] = ((9 << 0) | (3 << 12));
+	game->scoreMap[2] = ((9 << 0) | (3 << 12));
+	game->scoreMap[3] = ((9 << 0) | (3 << 12));
+	game->scoreMap[4] = ((9 << 0) | (3 << 12));
+
+
+	// positional values and timers
+	game->xPos = 50;
+	game->yPos = 80;
+	game->meteorX1 = 240;
+	game->meteorX2 = 240;
+	game->meteorX3 = 240;
+	game->meteorX4 = 240;
+	game->meteorX5 = 240;
+	game->meteorX6 = 240;
+	game->meteorY1 = 16;
+	game->meteorY2 = 32;
+	game->meteorY3 = 48;
+	game->meteorY4 = 64;
+	game->meteorY5 = 80;
+	game->meteorY6 = 96;
+	game->timer1 = 0;
+	game->timer2 = 0;
+	game->timer3 = 0;
+	game->timer4 = 0;
+	game->timer5 = 0;
+	game->timer6 = 0;
+
+	// rocket
+	game->oam[(0 * 4) + 0] = ((game->yPos << 0) | (1 << 14)); // y | OBJ shape
+	game->oam[(0 * 4) + 1] = ((game->xPos << 0) | (0 << 14)); // x | OBJ size
+	game->oam[(0 * 4) + 2] = ((1 << 0) | (1 << 12)); // tile num | palette num
+
+	// meteor 1
+	game->oam[(1 * 4) + 0] = ((game->meteorY1 << 0) | (0 << 14)); // y | OBJ shape
+	game->oam[(1 * 4) + 1] = ((game->meteorX1 << 0) | (1 << 14)); // x | OBJ size
+	game->oam[(1 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
+	// meteor 2
+	game->oam[(2 * 4) + 0] = ((game->meteorY2 << 0) | (0 << 14)); // y | OBJ shape
+	game->oam[(2 * 4) + 1] = ((game->meteorX2 << 0) | (1 << 14)); // x | OBJ size
+	game->oam[(2 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
+	// meteor 3
+	game->oam[(3 * 4) + 0] = ((game->meteorY3 << 0) | (0 << 14)); // y | OBJ shape
+	game->oam[(3 * 4) + 1] = ((game->meteorX3 << 0) | (1 << 14)); // x | OBJ size
+	game->oam[(3 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
+	// meteor 4
+	game->oam[(4 * 4) + 0] = ((game->meteorY4 << 0) | (0 << 14)); // y | OBJ shape
+	game->oam[(4 * 4) + 1] = ((game->meteorX4 << 0) | (1 << 14)); // x | OBJ size
+	game->oam[(4 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
+	// meteor 5
+	game->oam[(5 * 4) + 0] = ((game->meteorY5 << 0) | (0 << 14)); // y | OBJ shape
+	game->oam[(5 * 4) + 1] = ((game->meteorX5 << 0) | (1 << 14)); // x | OBJ size
+	game->oam[(5 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
+	// meteor 6
+	game->oam[(6 * 4) + 0] = ((game->meteorY6 << 0) | (0 << 14)); // y | OBJ shape
+	game->oam[(6 * 4) + 1] = ((game->meteorX6 << 0) | (1 << 14)); // x | OBJ size
+	game->oam[(6 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
+	// homing meteors start hidden
+	game->homingTimer = 0;
+	for (int i = 0; i < HOMING_COUNT; i++)
+	{
+		game->homing[i].active = 0;
+		homingToOam(&game->homing[i], i, game->oam);
+	}
+
+	game->xScroll0 = 0;
+	game->xScroll1 = 0;
+	game->shouldScroll = true;
+}
+
+void gameUpdate(GameState* game, uint16 buttonsPressed)
+{
+	uint16 digit5;
+	uint16 digit4;
+	uint16 digit3;
+	uint16 digit2;
+	uint16 digit1;
+	Collision coll;
+
+	game->frame++;
+	game->scoreTimer++;
+	game->timer1++;
+	game->timer2++;
+	game->timer3++;
+	game->timer4++;
+	game->timer5++;
+	game->timer6++;
+
+	if (game->scoreTimer > 59)
+	{
+		game->score++;
+		// divide score into 5 digits for display
+		digit5 = game->score / 10000 % 10;
+		digit4 = game->score / 1000 % 10;
+		digit3 = game->score / 100 % 10;
+		digit2 = game->score / 10 % 10;
+		digit1 = game->score % 10;
+
+		// display score
+		if (!game->gameOver)
+		{
+			game->scoreMap[0] = (((digit5 + 9) << 0) | (3 << 12));
+			game->scoreMap[1] = (((digit4 + 9) << 0) | (3 << 12));
+			game->scoreMap[2] = (((digit3 + 9) << 0) | (3 << 12));
+			game->scoreMap[3] = (((digit2 + 9) << 0) | (3 << 12));
+			game->scoreMap[4] = (((digit1 + 9) << 0) | (3 << 12));
+		}		
+		game->scoreTimer = 0;
+	}
+
+	if (game->frame > 1 && !game->gameOver) // handles background scrolling
+	{
+		game->xScroll0++;
+		if (game->xScroll0 > 255)
+		{
+			game->xScroll0 = 0;
+		}
+		if (game->shouldScroll) // bg1 scrolls every other frame for parallax effect
+		{
+			game->xScroll1++;
+		}
+		game->shouldScroll = !game->shouldScroll;
+		if (game->xScroll1 > 255)
+		{
+			game->xScroll1 = 0;
+		}
+	}
+
+	if (!game->gameOver)
+	{
+		short randomY = 1;
+		short prevY = 1;
+
+		// meteor1 y
+		if (game->timer1 > 119) // meteor crosses screen every 120 frames
+		{
+			prevY = randomY;
+			do
+			{
+				randomY = gameRandom(game) % 9 + 1; // new y value is randomly selected every time meteor crosses screen
+			} while (randomY == prevY);
+			game->meteorY1 = randomY * 16;
+			game->oam[(1 * 4) + 0] = ((game->meteorY1 << 0) | (0 << 14)); // update y position
+			game->timer1 = 0; // reset timer
+		}
+		// meteor1 x
+		game->meteorX1 = game->meteorX1 - 2; // meteor constantly moving from right to left
+		if (game->meteorX1 < 1) // once meteor reaches end of screen on left
+		{
+			game->meteorX1 = 240; // reset position to the right
+		}
+		game->oam[(1 * 4) + 1] = ((game->meteorX1 << 0) | (1 << 14)); // update x position
+
+		// meteor2 y
+		if (game->timer2 > 139)
+		{
+			prevY = randomY;
+			do
+			{
+				randomY = gameRandom(game) % 9 + 1; // new y value is randomly selected every time meteor crosses screen
+			} while (randomY == prevY);
+			game->meteorY2 = randomY * 16;
+			game->oam[(2 * 4) + 0] = ((game->meteorY2 << 0) | (0 << 14)); // update y position
+			game->timer2 = 20;
+		}
+		// meteor2 x
+		if (game->timer2 > 19)
+		{
+			game->meteorX2 = game->meteorX2 - 2;
+			if (game->meteorX2 < 1)
+			{
+				game->meteorX2 = 240;
+			}
+			if (game->frame > 1440 + 20)
+			{
+				game->oam[(2 * 4) + 1] = ((game->meteorX2 << 0) | (1 << 14));
+			}
+			else
+			{
+				game->oam[(2 * 4) + 1] = ((240 << 0) | (1 << 14));
+			}
+		}
+
+		// meteor3 y
+		if (game->timer3 > 159)
+		{
+			prevY = randomY;
+			do
+			{
+				randomY = gameRandom(game) % 9 + 1; // new y value is randomly selected every time meteor crosses screen
+			} while (randomY == prevY);
+			game->meteorY3 = randomY * 16;
+			game->oam[(3 * 4) + 0] = ((game->meteorY3 << 0) | (0 << 14)); // update y position
+			game->timer3 = 40;
+		}
+		// meteor3 x
+		if (game->timer3 > 39)
+		{
+			game->meteorX3 = game->meteorX3 - 2;
+			if (game->meteorX3 < 1)
+			{
+				game->meteorX3 = 240;
+			}
+			if (game->frame > 720 + 40)
+			{
+				game->oam[(3 * 4) + 1] = ((game->meteorX3 << 0) | (1 << 14));
+			}
+			else
+			{
+				game->oam[(3 * 4) + 1] = ((240 << 0) | (1 << 14));
+			}
+		}
+
+		// meteor4 y
+		if (game->timer4 > 179)
+		{
+			prevY = randomY;
+			do
+			{
+				randomY = gameRandom(game) % 9 + 1; // new y value is randomly selected every time meteor crosses screen
+			} while (randomY == prevY);
+			game->meteorY4 = randomY * 16;
+			game->oam[(4 * 4) + 0] = ((game->meteorY4 << 0) | (0 << 14)); // update y position
+			game->timer4 = 60;
+		}
+		// meteor4 x
+		if (game->timer4 > 59)
+		{
+			game->meteorX4 = game->meteorX4 - 2;
+			if (game->meteorX4 < 1)
+			{
+				game->meteorX4 = 240;
+			}
+			if (game->frame < 720 + 60 || game->frame > 1440 + 60)
+			{
+				game->oam[(4 * 4) + 1] = ((game->meteorX4 << 0) | (1 << 14));
+			}
+			else
+			{
+				game->oam[(4 * 4) + 1] = ((240 << 0) | (1 << 14));
+			}
+		}
+
+		// meteor5 y
+		if (game->timer5 > 199)
+		{
+			prevY = randomY;
+			do
+			{
+				randomY = gameRandom(game) % 9 + 1; // new y value is randomly selected every time meteor crosses screen
+			} while (randomY == prevY);
+			game->meteorY5 = randomY * 16;
+			game->oam[(5 * 4) + 0] = ((game->meteorY5 << 0) | (0 << 14)); // update y position
+			game->timer5 = 80;
+		}
+		// meteor5 x
+		if (game->timer5 > 79)
+		{
+			game->meteorX5 = game->meteorX5 - 2;
+			if (game->meteorX5 < 1)
+			{
+				game->meteorX5 = 240;
+			}
+			if (game->frame > 720 + 80)
+			{
+				game->oam[(5 * 4) + 1] = ((game->meteorX5 << 0) | (1 << 14));
+			}
+			else
+			{
+				game->oam[(5 * 4) + 1] = ((240 << 0) | (1 << 14));
+			}
+		}
+
+		// meteor6 y
+		if (game->timer6 > 219)
+		{
+			prevY = randomY;
+			do
+			{
+				randomY = gameRandom(game) % 9 + 1; // new y value is randomly selected every time meteor crosses screen
+			} while (randomY == prevY);
+			game->meteorY6 = randomY * 16;
+			game->oam[(6 * 4) + 0] = ((game->meteorY6 << 0) | (0 << 14)); // update y position
+			game->timer6 = 100;
+		}
+		// meteor6 x
+		if (game->timer6 > 99)
+		{
+			game->meteorX6 = game->meteorX6 - 2;
+			if (game->meteorX6 < 1)
+			{
+				game->meteorX6 = 240;
+			}
+			if (game->frame > 1440 + 100)
+			{
+				game->oam[(6 * 4) + 1] = ((game->meteorX6 << 0) | (1 << 14));
+			}
+			else
+			{
+				game->oam[(6 * 4) + 1] = ((240 << 0) | (1 << 14));
+			}
+		}
+
+		// homing meteors join in once all 6 normal ones are out
+		if (game->frame > 1440 + 100)
+		{
+			game->homingTimer++;
+			for (int i = 0; i < HOMING_COUNT; i++)
+			{
+				if (!game->homing[i].active && game->homingTimer > HOMING_SPAWN_FRAMES)
+				{
+					homingSpawn(&game->homing[i], (gameRandom(game) % 9 + 1) * 16);
+					game->homingTimer = 0;
+				}
+				homingUpdate(&game->homing[i], game->xPos, game->yPos - 4); // aim its middle at the middle of the rocket
+				homingToOam(&game->homing[i], i, game->oam);
+			}
+		}
+	}
+
+	game->seed += buttonsPressed; // mix the player's inputs into the random numbers
+
+	if (!game->gameOver)
+	{
+		if (buttonsPressed & RIGHT)
+		{
+			game->xPos++;
+			if (game->xPos > 220)
+			{
+				game->xPos = 220;
+			}
+			game->oam[(0 * 4) + 1] = ((game->xPos << 0) | (0 << 14));
+		}
+		if (buttonsPressed & LEFT)
+		{
+			game->xPos--;
+			if (game->xPos < 1)
+			{
+				game->xPos = 1;
+			}
+			game->oam[(0 * 4) + 1] = ((game->xPos << 0) | (0 << 14));
+		}
+		if (buttonsPressed & UP)
+		{
+			game->yPos--;
+			if (game->yPos < 1)
+			{
+				game->yPos = 1;
+			}
+			game->oam[(0 * 4) + 0] = ((game->yPos << 0) | (1 << 14));
+		}
+		if (buttonsPressed & DOWN)
+		{
+			game->yPos++;
+			if (game->yPos > 151)
+			{
+				game->yPos = 151;
+			}
+			game->oam[(0 * 4) + 0] = ((game->yPos << 0) | (1 << 14));
+		}
+	}
+
+	// collision tests
+	coll.x11 = game->meteorX1;
+	coll.y11 = game->meteorY1;
+	coll.x21 = game->meteorX2;
+	coll.y21 = game->meteorY2;
+	coll.x31 = game->meteorX3;
+	coll.y31 = game->meteorY3;
+	coll.x41 = game->meteorX4;
+	coll.y41 = game->meteorY4;
+	coll.x51 = game->meteorX5;
+	coll.y51 = game->meteorY5;
+	coll.x61 = game->meteorX6;
+	coll.y61 = game->meteorY6;
+
+	collFunction(&coll); // ARM CPU THUMB Code to calculate collision boundaries
+
+	// meteor1		
+	if (game->xPos > coll.x11 && game->xPos < coll.x12 && game->yPos > coll.y11 && game->yPos < coll.y12)
+	{
+		game->gameOver = true;
+	}
+	// meteor2
+	if ((game->xPos > coll.x21 && game->xPos < coll.x22 && game->yPos > coll.y21 && game->yPos < coll.y22) && game->frame > 1440 + 20)
+	{
+		game->gameOver = true;
+	}
+	// meteor3
+	if ((game->xPos > coll.x31 && game->xPos < coll.x32 && game->yPos > coll.y31 && game->yPos < coll.y32) && game->frame > 720 + 40)
+	{
+		game->gameOver = true;
+	}
+	// meteor4
+	if ((game->xPos > coll.x41 && game->xPos < coll.x42 && game->yPos > coll.y41 && game->yPos < coll.y42) && (game->frame < 720 + 60 || game->frame > 1440 + 60))
+	{
+		game->gameOver = true;
+	}
+	// meteor5
+	if ((game->xPos > coll.x51 && game->xPos < coll.x52 && game->yPos > coll.y51 && game->yPos < coll.y52) && game->frame > 720 + 80)
+	{
+		game->gameOver = true;
+	}
+	// meteor6
+	if ((game->xPos > coll.x61 && game->xPos < coll.x62 && game->yPos > coll.y61 && game->yPos < coll.y62) && game->frame > 1440 + 100)
+	{
+		game->gameOver = true;
+	}
+	// homing meteors
+	for (int i = 0; i < HOMING_COUNT; i++)
+	{
+		if (homingHits(&game->homing[i], game->xPos, game->yPos))
+		{
+			game->gameOver = true;
+		}
+	}
+}
@@ -0,0 +1,20 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include "gamestate.h"
+
+// gameplay only, no hardware access, so the same code also builds into the tools/simulator balancing tool
+
+// define input keys
+#define BUTTON_A	(1 << 0)
+#define BUTTON_B	(1 << 1)
+#define START	(1 << 3)
+#define RIGHT	(1 << 4)
+#define LEFT	(1 << 5)
+#define UP	(1 << 6)
+#define DOWN	(1 << 7)
+
+void gameInit(GameState* game, uint32 seed); // the state at the start of a game
+void gameUpdate(GameState* game, uint16 buttonsPressed); // runs one frame: score, scrolling, meteors, movement and collisions
+
+#endif
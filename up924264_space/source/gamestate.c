@@ -0,0 +1,110 @@
+#include "gamestate.h"
+#include "arena.h"
+#include "debug.h"
+
+// GBA docs are here:	https://mgba-emu.github.io/gbatek/
+
+static volatile uint16* const VCOUNT = (volatile uint16*)0x4000006;
+static volatile uint32* const DMA3_SOURCE = (volatile uint32*)0x40000D4;
+static volatile uint32* const DMA3_DEST = (volatile uint32*)0x40000D8;
+static volatile uint32* const DMA3_CONTROL = (volatile uint32*)0x40000DC;
+
+static volatile uint16* const OAM = (volatile uint16*)0x7000000;
+static volatile uint16* const MAPMEM = (volatile uint16*)0x6004000;
+static volatile uint16* const BG1XSCROLL = (volatile uint16*)0x4000014;
+static volatile uint16* const BG2XSCROLL = (volatile uint16*)0x4000018;
+
+// snapshots come from the arena in ewram, there isn't room for them in iwram
+static GameState* rewindStates;
+static uint16 rewindNewest = 0;
+static uint16 rewindCount = 0;
+
+// the near stars are split into 32 line bands, the top and bottom ones pass at twice the speed.
+// whole multiples keep the bands seamless when xScroll0 wraps at 256, the last entry is for the vblank lines
+static const uint8 bandSpeed[6] = { 2, 1, 1, 1, 2, 1 };
+static uint16 nearScroll = 0; // xScroll0 of the frame on screen
+
+static void dmaCopy32(volatile void* to, const void* from, uint32 bytes)
+{
+	DMA3_SOURCE[0] = (uint32)from;
+	DMA3_DEST[0] = (uint32)to;
+	DMA3_CONTROL[0] = ((bytes / 4) << 0) | (1 << 26) | (1u << 31); // word count | 32 bit | enable
+}
+
+void stateInit(void)
+{
+	rewindStates = arenaAlloc(sizeof(GameState) * REWIND_FRAMES);
+	if (!rewindStates)
+	{
+		debugPrint("no room for the rewind ring, rewinding is off");
+	}
+}
+
+void stateCopy(GameState* to, const GameState* from)
+{
+	dmaCopy32(to, from, sizeof(GameState));
+}
+
+void stateRefresh(const GameState* state)
+{
+	dmaCopy32(OAM, state->oam, sizeof(state->oam));
+	MAPMEM[0] = state->scoreMap[0];
+	MAPMEM[1] = state->scoreMap[1];
+	MAPMEM[2] = state->scoreMap[2];
+	MAPMEM[3] = state->scoreMap[3];
+	MAPMEM[4] = state->scoreMap[4];
+	nearScroll = state->xScroll0; // stateHBlank() writes it to the hardware band by band
+	BG2XSCROLL[0] = state->xScroll1;
+}
+
+void stateHBlank(void)
+{
+	uint16 line = VCOUNT[0] + 1; // hblank is at the end of a line, so this sets up the next one
+	if (line == 228)
+	{
+		line = 0;
+	}
+	if ((line & 31) == 0 && line <= 160)
+	{
+		BG1XSCROLL[0] = nearScroll * bandSpeed[line >> 5];
+	}
+}
+
+void stateRecord(const GameState* state)
+{
+	if (!rewindStates)
+	{
+		return; // nothing is recorded, so stateRewind() always returns false
+	}
+	rewindNewest++;
+	if (rewindNewest == REWIND_FRAMES)
+	{
+		rewindNewest = 0;
+	}
+	if (rewindCount < REWIND_FRAMES)
+	{
+		rewindCount++;
+	}
+	stateCopy(&rewindStates[rewindNewest], state);
+}
+
+bool stateRewind(GameState* state)
+{
+	if (rewindCount == 0)
+	{
+		return false;
+	}
+	stateCopy(state, &rewindStates[rewindNewest]);
+	if (rewindNewest == 0)
+	{
+		rewindNewest = REWIND_FRAMES;
+	}
+	rewindNewest--;
+	rewindCount--;
+	return true;
+}
+
+void stateClearRewind(void)
+{
+	rewindCount = 0;
+}
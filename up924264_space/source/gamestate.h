@@ -0,0 +1,56 @@
+#ifndef GAMESTATE_H
+#define GAMESTATE_H
+
+#include <gba_types.h>	// for bool
+#include "types.h"
+#include "homing.h"
+
+// number of frames kept for rewinding, 2 seconds worth
+#define REWIND_FRAMES 120
+
+typedef struct GameState // everything that changes while playing, kept together so it can be copied in one go
+{
+	uint16 oam[16 * 4]; // shadow copy of the first 16 sprites, copied to oam every vblank
+	uint16 scoreMap[5]; // score digit map entries
+	uint32 seed;
+	uint32 frame;
+	uint32 score;
+	uint16 scoreTimer;
+	uint16 timer1;
+	uint16 timer2;
+	uint16 timer3;
+	uint16 timer4;
+	uint16 timer5;
+	uint16 timer6;
+	short xPos;
+	short yPos;
+	short meteorX1;
+	short meteorX2;
+	short meteorX3;
+	short meteorX4;
+	short meteorX5;
+	short meteorX6;
+	short meteorY1;
+	short meteorY2;
+	short meteorY3;
+	short meteorY4;
+	short meteorY5;
+	short meteorY6;
+	uint16 xScroll0;
+	uint16 xScroll1;
+	bool shouldScroll;
+	bool gameOver;
+	uint16 homingTimer;
+	Homing homing[HOMING_COUNT];
+} __attribute__((aligned(4))) GameState;
+
+void stateInit(void); // sets up the rewind ring, before anything else uses the arena
+void stateCopy(GameState* to, const GameState* from); // dma copy of the whole state
+void stateRefresh(const GameState* state); // copies the shadow oam, score and scroll to the hardware, call during vblank
+void stateHBlank(void); // hblank handler, scrolls the near stars faster along the top and bottom of the screen
+
+void stateRecord(const GameState* state); // push a snapshot onto the rewind ring
+bool stateRewind(GameState* state); // pop the latest snapshot, returns false once there are none left
+void stateClearRewind(void);
+
+#endif
@@ -0,0 +1,74 @@
+#include "homing.h"
+
+void homingSpawn(Homing* h, short y)
+{
+	h->x = INT_TO_FIX(240);
+	h->y = INT_TO_FIX(y);
+	h->xSpeed = -HOMING_SPEED;
+	h->ySpeed = 0;
+	h->life = HOMING_LIFETIME;
+	h->angle = 128;
+	h->active = 1;
+}
+
+void homingUpdate(Homing* h, short targetX, short targetY)
+{
+	if (!h->active)
+	{
+		return;
+	}
+
+	if (h->life > 0)
+	{
+		fixed dx = INT_TO_FIX(targetX) - h->x;
+		fixed dy = INT_TO_FIX(targetY) - h->y;
+		fixNormalize(&dx, &dy);
+
+		// turn a little towards the rocket each frame so it can still be dodged
+		h->xSpeed += (FIX_MUL(dx, HOMING_SPEED) - h->xSpeed) >> HOMING_TURN_SHIFT;
+		h->ySpeed += (FIX_MUL(dy, HOMING_SPEED) - h->ySpeed) >> HOMING_TURN_SHIFT;
+		h->angle = fixAtan2(h->ySpeed, h->xSpeed);
+		h->life--;
+	}
+
+	h->x += h->xSpeed;
+	h->y += h->ySpeed;
+
+	// gone once it's off the screen
+	if (h->x < INT_TO_FIX(-16) || h->x > INT_TO_FIX(240) || h->y < INT_TO_FIX(-16) || h->y > INT_TO_FIX(160))
+	{
+		h->active = 0;
+	}
+}
+
+bool homingHits(const Homing* h, short x, short y)
+{
+	short hx = FIX_TO_INT(h->x);
+	short hy = FIX_TO_INT(h->y);
+
+	// same boundaries collFunction works out for the normal meteors
+	return h->active && x > hx - 16 && x < hx + 16 && y > hy - 8 && y < hy + 16;
+}
+
+void homingToOam(const Homing* h, uint16 index, uint16* oam)
+{
+	uint16* sprite = &oam[(HOMING_SPRITE + index) * 4];
+	uint16* matrix = &oam[(index * 16) + 3]; // affine matrices sit in the 4th halfword of every sprite, 4 sprites each
+
+	if (!h->active)
+	{
+		sprite[0] = (1 << 9); // hide
+		return;
+	}
+
+	sprite[0] = (((FIX_TO_INT(h->y) & 0xFF) << 0) | (1 << 8) | (0 << 14)); // y | affine | OBJ shape
+	sprite[1] = (((FIX_TO_INT(h->x) & 0x1FF) << 0) | (index << 9) | (1 << 14)); // x | affine matrix | OBJ size
+	sprite[2] = ((4 << 0) | (3 << 12)); // tile num | palette num
+
+	// rotate the meteor to face the way it's flying, the matrix maps screen to texture so it's the inverse rotation
+	// and angles go clockwise because y points down
+	matrix[0] = fixCos(h->angle);
+	matrix[4] = fixSin(h->angle);
+	matrix[8] = -fixSin(h->angle);
+	matrix[12] = fixCos(h->angle);
+}
@@ -0,0 +1,30 @@
+#ifndef HOMING_H
+#define HOMING_H
+
+#include <gba_types.h>	// for bool
+#include "fixmath.h"
+
+#define HOMING_COUNT 2
+#define HOMING_SPRITE 7 // first oam entry used, after the rocket and the 6 meteors
+#define HOMING_SPAWN_FRAMES 300 // gap between homing meteors
+#define HOMING_LIFETIME 360 // frames spent chasing before it gives up and flies off
+#define HOMING_SPEED (FIX_ONE + (FIX_ONE >> 2)) // 1.25 pixels a frame
+#define HOMING_TURN_SHIFT 4 // how slowly it turns, each frame it moves 1/16 of the way towards the rocket
+
+typedef struct Homing // a meteor that steers towards the rocket
+{
+	fixed x;
+	fixed y;
+	fixed xSpeed;
+	fixed ySpeed;
+	uint16 life;
+	uint8 angle;
+	uint8 active;
+} Homing;
+
+void homingSpawn(Homing* h, short y);
+void homingUpdate(Homing* h, short targetX, short targetY);
+bool homingHits(const Homing* h, short x, short y);
+void homingToOam(const Homing* h, uint16 index, uint16* oam); // writes sprite HOMING_SPRITE + index and affine matrix index
+
+#endif
@@ -0,0 +1,147 @@
+#include <stddef.h>
+
+#include "interrupt.h"
+#include "debug.h"
+
+// GBA docs are here:	https://mgba-emu.github.io/gbatek/
+
+static volatile uint16* const DISPLAYSTATUS = (volatile uint16*)0x4000004;
+static volatile uint16* const TIMER3_DATA = (volatile uint16*)0x400010C;
+static volatile uint16* const TIMER3_CONTROL = (volatile uint16*)0x400010E;
+static volatile uint16* const INTENABLE = (volatile uint16*)0x4000200; // REG_IE
+static volatile uint16* const INTFLAGS = (volatile uint16*)0x4000202; // REG_IF
+static volatile uint16* const INTMASTER = (volatile uint16*)0x4000208; // REG_IME
+static IntHandler* const BIOSHANDLER = (IntHandler*)0x3007FFC; // the bios calls this on every irq
+
+#define INT_TABLE_SIZE 14
+
+// interrupt_dispatch.s walks the table with these offsets hard coded
+_Static_assert(sizeof(IntEntry) == 16, "interrupt_dispatch.s steps through intTable 16 bytes at a time");
+_Static_assert(offsetof(IntEntry, nestMask) == 2, "interrupt_dispatch.s reads nestMask from [r12, #2]");
+_Static_assert(offsetof(IntEntry, handler) == 4, "interrupt_dispatch.s reads handler from [r12, #4]");
+_Static_assert(offsetof(IntEntry, count) == 8, "interrupt_dispatch.s reads count from [r12, #8]");
+_Static_assert(offsetof(IntEntry, worstLatency) == 12, "interrupt_dispatch.s reads worstLatency from [r12, #12]");
+
+extern void intDispatch(void);
+
+// one entry per source plus the 0 mask at the end
+IntEntry intTable[INT_TABLE_SIZE + 1];
+
+// the sources that are allowed to interrupt a handler are the critical ones with a higher priority
+static void updateNesting(void)
+{
+	uint16 critical = 0;
+	int i;
+	for (i = 0; intTable[i].mask; i++)
+	{
+		intTable[i].nestMask = critical;
+		if (intTable[i].critical)
+		{
+			critical |= intTable[i].mask;
+		}
+	}
+}
+
+void intInit(void)
+{
+	int i;
+
+	INTMASTER[0] = 0;
+	for (i = 0; i < INT_TABLE_SIZE + 1; i++)
+	{
+		intTable[i].mask = 0;
+	}
+	INTENABLE[0] = 0;
+	INTFLAGS[0] = 0xFFFF; // acknowledge anything left over
+
+	// timer 3 free runs at the cpu clock so the dispatcher can time itself
+	TIMER3_DATA[0] = 0;
+	TIMER3_CONTROL[0] = ((0 << 0) | (1 << 7)); // 1 cycle prescaler | enable
+
+	BIOSHANDLER[0] = intDispatch;
+	INTMASTER[0] = 1;
+}
+
+void intSet(uint16 mask, IntHandler handler, uint8 priority, bool critical)
+{
+	int i;
+	int j;
+
+	INTMASTER[0] = 0; // the dispatcher mustn't see the table half changed
+
+	// take out any existing entry for this source
+	for (i = 0; intTable[i].mask; i++)
+	{
+		if (intTable[i].mask == mask)
+		{
+			for (j = i; intTable[j].mask; j++)
+			{
+				intTable[j] = intTable[j + 1];
+			}
+			break;
+		}
+	}
+
+	// find the end of the table, a full table has no room left for the 0 mask after a new entry
+	for (j = 0; intTable[j].mask; j++)
+	{
+	}
+
+	if (handler && j < INT_TABLE_SIZE)
+	{
+		// insert it after everything with the same or a higher priority
+		for (i = 0; intTable[i].mask && intTable[i].priority <= priority; i++)
+		{
+		}
+		intTable[j + 1].mask = 0;
+		for (; j > i; j--)
+		{
+			intTable[j] = intTable[j - 1];
+		}
+		intTable[i].mask = mask;
+		intTable[i].handler = handler;
+		intTable[i].count = 0;
+		intTable[i].worstLatency = 0;
+		intTable[i].priority = priority;
+		intTable[i].critical = critical;
+	}
+
+	updateNesting();
+	INTMASTER[0] = 1;
+}
+
+void intEnable(uint16 mask)
+{
+	INTMASTER[0] = 0;
+	if (mask & IRQ_VBLANK) DISPLAYSTATUS[0] |= (1 << 3);
+	if (mask & IRQ_HBLANK) DISPLAYSTATUS[0] |= (1 << 4);
+	if (mask & IRQ_VCOUNT) DISPLAYSTATUS[0] |= (1 << 5);
+	INTENABLE[0] |= mask;
+	INTMASTER[0] = 1;
+}
+
+void intDisable(uint16 mask)
+{
+	INTMASTER[0] = 0;
+	if (mask & IRQ_VBLANK) DISPLAYSTATUS[0] &= ~(1 << 3);
+	if (mask & IRQ_HBLANK) DISPLAYSTATUS[0] &= ~(1 << 4);
+	if (mask & IRQ_VCOUNT) DISPLAYSTATUS[0] &= ~(1 << 5);
+	INTENABLE[0] &= ~mask;
+	INTMASTER[0] = 1;
+}
+
+uint16 intEnabled(void)
+{
+	return INTENABLE[0];
+}
+
+void intReport(void)
+{
+	int i;
+	for (i = 0; intTable[i].mask; i++)
+	{
+		debugPrintHex("irq ", intTable[i].mask);
+		debugPrintHex("irq calls ", intTable[i].count);
+		debugPrintHex("irq worst latency ", intTable[i].worstLatency);
+	}
+}
@@ -0,0 +1,33 @@
+#ifndef INTERRUPT_H
+#define INTERRUPT_H
+
+#include <gba_interrupt.h>	// for the IRQ_ masks
+#include "types.h"
+
+// lower numbers are handled first
+#define INT_PRIORITY_HBLANK 0
+#define INT_PRIORITY_AUDIO 1
+#define INT_PRIORITY_VBLANK 4
+#define INT_PRIORITY_IDLE 8
+
+typedef void (*IntHandler)(void);
+
+typedef struct IntEntry // one handler in the dispatch table, the layout is used by interrupt_dispatch.s
+{
+	uint16 mask; // IRQ_ bit this entry handles, 0 marks the end of the table
+	uint16 nestMask; // sources that are allowed to interrupt this handler
+	IntHandler handler;
+	uint32 count; // times the handler has been called
+	uint16 worstLatency; // most cpu cycles between the dispatcher starting and the handler being called
+	uint8 priority;
+	uint8 critical; // critical sources can interrupt any handler with a lower priority
+} IntEntry;
+
+void intInit(void); // installs the dispatcher, call instead of irqInit()
+void intSet(uint16 mask, IntHandler handler, uint8 priority, bool critical); // a null handler removes it, nothing is added once all 14 slots are taken
+void intEnable(uint16 mask);
+void intDisable(uint16 mask);
+uint16 intEnabled(void); // the sources that are currently enabled
+void intReport(void); // prints the call count and worst latency of every handler to the debug output
+
+#endif
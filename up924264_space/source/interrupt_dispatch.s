@@ -0,0 +1,98 @@
+@ ==================================
+@ interrupt dispatcher, the bios jumps here on every irq
+@ it is ARM code and sits in IWRAM because the 32 bit bus there makes it run much faster than from ROM
+@ ==================================
+
+.SYNTAX UNIFIED
+.SECTION .iwram, "ax", %progbits
+.ARM						@ the bios calls the handler in ARM mode
+.ALIGN  2
+.GLOBL  intDispatch
+
+@ the bios has already pushed r0-r3, r12 and lr onto the irq stack, so those are free to use
+
+intDispatch:
+	mov r3, #0x4000000		@ REG_BASE
+	ldr r0, [r3, #0x10C]	@ timer 3 counter, latency is measured from here
+	mov r0, r0, lsl #16		@ only the low halfword is the counter
+	push { r0, lr }			@ keep the entry time and the return address on the irq stack
+
+checkSources:
+	mov r3, #0x4000000
+	ldr r2, [r3, #0x200]	@ r2 = REG_IE | (REG_IF << 16)
+	ands r2, r2, r2, lsr #16	@ r2 = REG_IE & REG_IF, the sources waiting to be handled
+	beq dispatchDone
+	ldrh r1, [r3, #-8]		@ mix them into the bios irq flags at 3007FF8h,
+	orr r1, r1, r2			@ IntrWait and VBlankIntrWait wait on these
+	strh r1, [r3, #-8]
+	add r3, r3, #0x200		@ r3 = REG_IE
+	ldr r12, =intTable
+
+findSource:					@ the table is sorted highest priority first
+	ldrh r1, [r12]			@ entry mask
+	cmp r1, #0				@ 0 marks the end of the table
+	beq noHandler
+	ands r1, r1, r2
+	bne foundSource
+	add r12, r12, #16		@ size of an IntEntry
+	b findSource
+
+noHandler:
+	strh r2, [r3, #2]		@ acknowledge the sources nobody handles in REG_IF
+
+dispatchDone:
+	pop { r0, lr }
+	bx lr					@ back to the bios
+
+foundSource:
+	strh r1, [r3, #2]		@ acknowledge just this source in REG_IF
+
+	ldr r0, [r3, #-0xF4]	@ timer 3 counter again (0x400010C)
+	ldr r2, [sp]			@ entry time
+	rsb r2, r2, r0, lsl #16	@ (now - entry) << 16 so it wraps the same way the timer does
+	mov r2, r2, lsr #16		@ latency in cycles
+	ldrh r1, [r12, #12]		@ worstLatency
+	cmp r2, r1
+	strhhi r2, [r12, #12]
+	ldr r1, [r12, #8]		@ count
+	add r1, r1, #1
+	str r1, [r12, #8]
+
+	ldr r0, [r12, #4]		@ handler
+	ldrh r2, [r12, #2]		@ nestMask
+	cmp r2, #0
+	bne nestedCall
+
+	mov lr, pc				@ nothing can interrupt this one, call it straight from irq mode
+	bx r0
+	b checkSources			@ anything that came in while it ran is handled before returning
+
+nestedCall:
+	ldrh r1, [r3]			@ save REG_IE and the spsr, a nested irq overwrites the spsr
+	mrs r12, spsr
+	push { r1, r12 }
+	strh r2, [r3]			@ only the critical sources stay enabled while the handler runs
+
+	mrs r1, cpsr			@ switch to system mode with irqs on, so a nested irq
+	bic r1, r1, #0xDF		@ can't overwrite the irq mode lr
+	orr r1, r1, #0x1F
+	msr cpsr_c, r1
+
+	push { lr }				@ system mode lr, on the user stack
+	mov lr, pc
+	bx r0
+	pop { lr }
+
+	mrs r1, cpsr			@ back to irq mode with irqs off
+	bic r1, r1, #0xDF
+	orr r1, r1, #0x92
+	msr cpsr_c, r1
+
+	pop { r1, r12 }
+	msr spsr_fsxc, r12
+	mov r3, #0x4000000
+	add r3, r3, #0x200
+	strh r1, [r3]			@ put REG_IE back
+	b checkSources
+
+.POOL
@@ -0,0 +1,60 @@
+#include "interrupt.h"		// for interrupt handling
+#include "music.h"
+
+// GBA docs are here:	https://mgba-emu.github.io/gbatek/
+
+static volatile uint16* const SOUND2_FREQ = (volatile uint16*)0x400006C;
+static volatile uint16* const TIMER1_DATA = (volatile uint16*)0x4000104;
+static volatile uint16* const TIMER1_CONTROL = (volatile uint16*)0x4000106;
+
+// timer 1 runs at 16384hz, a frame is 280896 cycles which is about 274 ticks
+#define TICKS_PER_FRAME 274
+
+// frequency of notes used
+enum Notes { note_a = 1750, note_asharp = 1486, note_b = 1517, note_c = 1574, note_d = 1602, note_dh = 1825, note_f = 1673, note_g = 1714, note_gsharp = 1732};
+
+// order of notes in the song
+static const uint16 song[64] = {
+	note_d, note_d, note_dh, 0, note_a, 0, 0, note_gsharp, 0, note_g, 0, note_f, 0, note_d, note_f, note_g,
+	note_c, note_c, note_dh, 0, note_a, 0, 0, note_gsharp, 0, note_g, 0, note_f, 0, note_d, note_f, note_g,
+	note_b, note_b, note_dh, 0, note_a, 0, 0, note_gsharp, 0, note_g, 0, note_f, 0, note_d, note_f, note_g,
+	note_asharp, note_asharp, note_dh, 0, note_a, 0, 0, note_gsharp, 0, note_g, 0, note_f, 0, note_d, note_f, note_g
+};
+
+static uint16 currentNote = 0;
+
+static void musicTick(void)
+{
+	// cycle through notes of the song
+	uint16 theNote = song[currentNote];
+	if (theNote > 0)
+	{
+		SOUND2_FREQ[0] = ((theNote << 0) | (1 << 14) | (1 << 15));
+	}
+	currentNote = (currentNote + 1) & 63;
+}
+
+void musicInit(uint16 framesPerNote)
+{
+	TIMER1_CONTROL[0] = 0;
+	TIMER1_DATA[0] = 0x10000 - (framesPerNote * TICKS_PER_FRAME); // reload value, it counts up to the overflow
+	intSet(IRQ_TIMER1, musicTick, INT_PRIORITY_AUDIO, true);
+	intEnable(IRQ_TIMER1);
+}
+
+void musicStart(void)
+{
+	currentNote = 0;
+	musicTick(); // the first note plays straight away, the timer brings in the rest
+	musicResume();
+}
+
+void musicStop(void)
+{
+	TIMER1_CONTROL[0] = 0;
+}
+
+void musicResume(void)
+{
+	TIMER1_CONTROL[0] = ((3 << 0) | (1 << 6) | (1 << 7)); // 1024 cycle prescaler | irq | enable
+}
@@ -0,0 +1,13 @@
+#ifndef MUSIC_H
+#define MUSIC_H
+
+#include "types.h"
+
+// the song is played from the timer 1 interrupt so the notes keep time whatever the main loop is doing.
+// framesPerNote has to be under 239 to fit in the timer
+void musicInit(uint16 framesPerNote);
+void musicStart(void); // plays from the first note
+void musicStop(void);
+void musicResume(void); // carries on from where musicStop() left off
+
+#endif
@@ -0,0 +1,89 @@
+#include "interrupt.h"		// for interrupt handling
+#include <gba_systemcalls.h>	// for Halt() and Stop()
+#include "power.h"
+
+// GBA docs are here:	https://mgba-emu.github.io/gbatek/
+
+static volatile uint16* const DISPLAYCONTROL = (volatile uint16*)0x4000000;
+static volatile uint16* const SOUND_VOLUMES = (volatile uint16*)0x4000080;
+static volatile uint16* const SOUND_MASTER = (volatile uint16*)0x4000084;
+static volatile uint16* const SOUND2_SETTINGS = (volatile uint16*)0x4000068;
+static volatile uint16* const INPUT = (volatile uint16*)0x4000130; // keypad input memory
+static volatile uint16* const KEYCONTROL = (volatile uint16*)0x4000132; // keypad interrupt control
+static volatile uint16* const TIMER2_DATA = (volatile uint16*)0x4000108;
+static volatile uint16* const TIMER2_CONTROL = (volatile uint16*)0x400010A;
+
+// timer 2 runs at 16384hz so it overflows every 4 seconds
+#define IDLE_TIMER_SECONDS 4
+
+static volatile uint16 idleOverflows = 0;
+
+static void idleTimerHandler(void)
+{
+	idleOverflows++;
+}
+
+static uint16 keysHeld(uint16 keys)
+{
+	return (~INPUT[0]) & keys; // flipping binary to check for button press and not button release
+}
+
+// stop mode turns off the cpu clock completely, only the keypad interrupt can wake it back up.
+// the lcd has to be blanked first and the sound circuit is powered down to save the most battery
+static void powerSleep(void)
+{
+	uint16 display = DISPLAYCONTROL[0];
+	uint16 volumes = SOUND_VOLUMES[0];
+	uint16 sound2 = SOUND2_SETTINGS[0];
+
+	DISPLAYCONTROL[0] = display | (1 << 7); // forced blank
+	SOUND_MASTER[0] = 0; // sound off, this clears the sound registers so they are restored below
+
+	Stop();
+
+	SOUND_MASTER[0] = (1 << 7);
+	SOUND_VOLUMES[0] = volumes;
+	SOUND2_SETTINGS[0] = sound2;
+	DISPLAYCONTROL[0] = display;
+}
+
+uint32 powerWaitForKeys(uint16 keys)
+{
+	uint32 ticks;
+	uint16 enabled;
+
+	// the keypad irq fires for as long as a key is held, so wait for the key that got us here to be let go
+	while (keysHeld(keys))
+	{
+		VBlankIntrWait();
+	}
+
+	// nothing else while idle so the cpu only wakes for the keypad or the idle timer
+	enabled = intEnabled();
+	intDisable(enabled);
+	intSet(IRQ_TIMER2, idleTimerHandler, INT_PRIORITY_IDLE, false);
+	intEnable(IRQ_KEYPAD | IRQ_TIMER2);
+	KEYCONTROL[0] = ((keys << 0) | (1 << 14)); // keys to watch | irq enable
+	idleOverflows = 0;
+	TIMER2_DATA[0] = 0; // reload value
+	TIMER2_CONTROL[0] = ((3 << 0) | (1 << 6) | (1 << 7)); // 1024 cycle prescaler | irq | enable
+
+	while (!keysHeld(keys))
+	{
+		Halt(); // sleep until the keypad or timer interrupt
+
+		if (idleOverflows >= IDLE_STOP_SECONDS / IDLE_TIMER_SECONDS && !keysHeld(keys))
+		{
+			powerSleep();
+		}
+	}
+
+	ticks = ((uint32)idleOverflows << 16) | TIMER2_DATA[0];
+
+	TIMER2_CONTROL[0] = 0;
+	KEYCONTROL[0] = 0;
+	intDisable(IRQ_KEYPAD | IRQ_TIMER2);
+	intEnable(enabled);
+
+	return ticks;
+}
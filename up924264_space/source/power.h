@@ -0,0 +1,13 @@
+#ifndef POWER_H
+#define POWER_H
+
+#include "types.h"
+
+// seconds spent waiting before the cpu is put into stop mode with the screen and sound off
+#define IDLE_STOP_SECONDS 120
+
+// halts the cpu until one of the given keys is pressed, nothing else runs while waiting.
+// returns the time waited in 1/16384 second ticks, handy for mixing into the random seed
+uint32 powerWaitForKeys(uint16 keys);
+
+#endif
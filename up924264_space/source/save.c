@@ -0,0 +1,151 @@
+#include "save.h"
+
+// GBA docs are here:	https://mgba-emu.github.io/gbatek/
+
+// sram sits on an 8 bit bus so it has to be read and written one byte at a time
+static volatile uint8* const SRAM = (volatile uint8*)0xE000000;
+
+// two copies are kept so the older one can be overwritten while the newer one stays intact.
+// if the power goes mid save the half written slot fails its checksum and the other one is used
+#define SLOT_SIZE 0x100
+#define SAVE_MAGIC 0x45564153 // "SAVE"
+#define SAVE_BYTES_PER_FRAME 32
+
+// lets flashcarts and emulators know the cartridge has sram
+const char saveType[12] __attribute__((aligned(4), used)) = "SRAM_V113";
+
+SaveData saveData;
+
+static SaveData slots[2]; // what is currently in each slot in sram
+static SaveData pending; // what the slot being written will hold once it's finished
+static uint16 newestSlot = 1;
+static uint16 writeSlot = 0;
+static uint16 writeCursor = 0;
+static bool writing = false;
+
+static uint32 checksum(const SaveData* data)
+{
+	const uint8* bytes = (const uint8*)data;
+	uint32 sum = 0;
+	uint16 i;
+	for (i = 0; i < sizeof(SaveData) - sizeof(uint32); i++)
+	{
+		sum = ((sum << 1) | (sum >> 31)) + bytes[i];
+	}
+	return sum;
+}
+
+static bool slotValid(const SaveData* data)
+{
+	return data->magic == SAVE_MAGIC && data->checksum == checksum(data);
+}
+
+void saveInit(void)
+{
+	uint16 slot;
+	uint16 i;
+
+	for (slot = 0; slot < 2; slot++)
+	{
+		uint8* bytes = (uint8*)&slots[slot];
+		for (i = 0; i < sizeof(SaveData); i++)
+		{
+			bytes[i] = SRAM[(slot * SLOT_SIZE) + i];
+		}
+	}
+
+	bool valid0 = slotValid(&slots[0]);
+	bool valid1 = slotValid(&slots[1]);
+
+	if (valid0 && (!valid1 || (int)(slots[0].sequence - slots[1].sequence) > 0))
+	{
+		newestSlot = 0;
+	}
+	else if (valid1)
+	{
+		newestSlot = 1;
+	}
+	else
+	{
+		// nothing saved yet, start from the defaults and write slot 0 first
+		for (i = 0; i < HIGHSCORE_COUNT; i++)
+		{
+			saveData.highScores[i] = 0;
+		}
+		saveData.magic = SAVE_MAGIC;
+		saveData.sequence = 0;
+		saveData.songSpeed = 8;
+		saveData.unused = 0;
+		newestSlot = 1;
+		return;
+	}
+
+	saveData = slots[newestSlot];
+}
+
+int saveAddScore(uint32 score)
+{
+	int pos = HIGHSCORE_COUNT;
+	int i;
+
+	while (pos > 0 && score > saveData.highScores[pos - 1])
+	{
+		pos--;
+	}
+	if (pos == HIGHSCORE_COUNT)
+	{
+		return -1;
+	}
+	for (i = HIGHSCORE_COUNT - 1; i > pos; i--)
+	{
+		saveData.highScores[i] = saveData.highScores[i - 1];
+	}
+	saveData.highScores[pos] = score;
+
+	saveCommit();
+	return pos;
+}
+
+void saveCommit(void)
+{
+	// always write over the older slot, restarting the scan if a save was already under way
+	writeSlot = newestSlot ^ 1;
+	saveData.magic = SAVE_MAGIC;
+	saveData.sequence++;
+	saveData.checksum = checksum(&saveData);
+	pending = saveData;
+	writeCursor = 0;
+	writing = true;
+}
+
+bool saveUpdate(void)
+{
+	const uint8* from = (const uint8*)&pending;
+	uint8* shadow = (uint8*)&slots[writeSlot];
+	uint16 written = 0;
+
+	if (!writing)
+	{
+		return false;
+	}
+
+	// only the bytes that differ from what's already in the slot get written
+	while (writeCursor < sizeof(SaveData) && written < SAVE_BYTES_PER_FRAME)
+	{
+		if (shadow[writeCursor] != from[writeCursor])
+		{
+			SRAM[(writeSlot * SLOT_SIZE) + writeCursor] = from[writeCursor];
+			shadow[writeCursor] = from[writeCursor];
+			written++;
+		}
+		writeCursor++;
+	}
+
+	if (writeCursor < sizeof(SaveData))
+	{
+		return true;
+	}
+	newestSlot = writeSlot; // finished, this slot is now the newest
+	writing = false;
+	return false;
+}
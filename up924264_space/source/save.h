@@ -0,0 +1,26 @@
+#ifndef SAVE_H
+#define SAVE_H
+
+#include <gba_types.h>	// for bool
+#include "types.h"
+
+#define HIGHSCORE_COUNT 5
+
+typedef struct SaveData // everything kept in battery backed sram
+{
+	uint32 magic;
+	uint32 sequence; // goes up on every save, the valid slot with the highest sequence is the newest
+	uint32 highScores[HIGHSCORE_COUNT]; // highest first
+	uint16 songSpeed;
+	uint16 unused;
+	uint32 checksum;
+} SaveData;
+
+extern SaveData saveData;
+
+void saveInit(void); // loads the newest valid slot, or defaults if there isn't one
+int saveAddScore(uint32 score); // returns the table position, or -1 if the score didn't make it
+void saveCommit(void); // queue saveData to be written out
+bool saveUpdate(void); // writes a few changed bytes, call once a frame. returns true while still writing
+
+#endif
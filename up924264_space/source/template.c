@@ -1,70 +1,30 @@
-#include <gba_interrupt.h>		// for interrupt handling
+#include "interrupt.h"		// for interrupt handling
 #include <gba_systemcalls.h>	// for VBlankIntrWait()
 #include <stdlib.h>     // for rand()
 #include <time.h>       // for time()
+#include "types.h"
+#include "power.h"		// for powerWaitForKeys()
+#include "save.h"		// for the high score table
+#include "gamestate.h"	// for GameState
+#include "arena.h"		// for arenaReport()
+#include "text.h"		// for textPrint()
+#include "game.h"		// for gameUpdate()
+#include "music.h"		// for musicStart()
 
 
-typedef unsigned int uint32;
-typedef unsigned short uint16;
-
-typedef struct Collision // structure to hold positional variables for calculating collisions
-{
-	uint16 x11;
-	uint16 y11;
-	uint16 x21;
-	uint16 y21;
-	uint16 x31;
-	uint16 y31;
-	uint16 x41;
-	uint16 y41;
-	uint16 x51;
-	uint16 y51;
-	uint16 x61;
-	uint16 y61;
-	uint16 x12;
-	uint16 y12;
-	uint16 x22;
-	uint16 y22;
-	uint16 x32;
-	uint16 y32;
-	uint16 x42;
-	uint16 y42;
-	uint16 x52;
-	uint16 y52;
-	uint16 x62;
-	uint16 y62;
-
-} Collision;
-
-extern void collFunction(void* c);
-
-// frequency of notes used
-enum Notes { note_a = 1750, note_asharp = 1486, note_b = 1517, note_c = 1574, note_d = 1602, note_dh = 1825, note_f = 1673, note_g = 1714, note_gsharp = 1732};
-
-// order of notes in the song
-uint16 song[64] = {
-	note_d, note_d, note_dh, 0, note_a, 0, 0, note_gsharp, 0, note_g, 0, note_f, 0, note_d, note_f, note_g,
-	note_c, note_c, note_dh, 0, note_a, 0, 0, note_gsharp, 0, note_g, 0, note_f, 0, note_d, note_f, note_g,
-	note_b, note_b, note_dh, 0, note_a, 0, 0, note_gsharp, 0, note_g, 0, note_f, 0, note_d, note_f, note_g,
-	note_asharp, note_asharp, note_dh, 0, note_a, 0, 0, note_gsharp, 0, note_g, 0, note_f, 0, note_d, note_f, note_g
-};
-
-// define input keys
-#define BUTTON_A	(1 << 0)
-#define BUTTON_B	(1 << 1)
-#define RIGHT	(1 << 4)
-#define LEFT	(1 << 5)
-#define UP	(1 << 6)
-#define DOWN	(1 << 7)
+static GameState game;
+EWRAM_BSS static GameState initialState; // snapshot taken at startup, restarting copies it back
 
 int main(void) {
 
 	// required to enable vBlank interrupts
-	irqInit();
-	irqEnable(IRQ_VBLANK);
+	intInit();
+	intSet(IRQ_HBLANK, stateHBlank, INT_PRIORITY_HBLANK, true); // raster scroll for the near stars
+	intEnable(IRQ_VBLANK | IRQ_HBLANK);
 
-	uint32 frame = 0;
-	bool gameOver = false;
+	saveInit(); // load high scores and settings from sram
+	stateInit();
+	textInit();
 
 	// pointer to the memory that controls the display options
 	uint16* DISPLAYCONTROL = (uint16*)0x4000000;
@@ -224,21 +184,6 @@ int main(void) {
 	uint16 yStar = 0;
 	uint16 yStar1 = 0;
 
-	uint32 score = 0;
-	uint16 scoreTimer = 0;
-	uint16 digit5;
-	uint16 digit4;
-	uint16 digit3;
-	uint16 digit2;
-	uint16 digit1;
-
-	// display initial score
-	MAPMEM[0] = ((9 << 0) | (3 << 12));
-	MAPMEM[1] = ((9 << 0) | (3 << 12));
-	MAPMEM[2] = ((9 << 0) | (3 << 12));
-	MAPMEM[3] = ((9 << 0) | (3 << 12));
-	MAPMEM[4] = ((9 << 0) | (3 << 12));
-
 	// display bg1 stars
 	for (yStar = 0; yStar < 20; yStar++) // collumn 0 to 20
 	{
@@ -270,11 +215,7 @@ int main(void) {
 	SOUND_VOLUMES[0] = ((4 << 0) | (4 << 4) | (1 << 9) | (1 << 13));
 	uint16* SOUND2_SETTINGS = (uint16*)0x4000068;
 	SOUND2_SETTINGS[0] = ((0 << 0) | (2 << 6) | (0 << 8) | (4 << 12));
-	uint16* SOUND2_FREQ = (uint16*)0x400006C;
-
-	uint16 songSpeed = 8;
-	uint16 currentNote = 0;
-	uint16 currentFrame = 0;
+	musicInit(saveData.songSpeed);
 
 	uint16* OBJPALETTE = (uint16*)0x5000200;
 	// rocket palette
@@ -289,6 +230,11 @@ int main(void) {
 	OBJPALETTE[(2 * 16) + 2] = ((15 << 0) | (9 << 5) | (5 << 10)); // light brown
 	OBJPALETTE[(2 * 16) + 3] = ((10 << 0) | (10 << 5) | (10 << 10)); // grey
 
+	// homing meteor palette
+	OBJPALETTE[(3 * 16) + 1] = ((14 << 0) | (3 << 5) | (3 << 10)); // dark red
+	OBJPALETTE[(3 * 16) + 2] = ((24 << 0) | (6 << 5) | (4 << 10)); // red
+	OBJPALETTE[(3 * 16) + 3] = ((31 << 0) | (16 << 5) | (8 << 10)); // light red
+
 	uint32* OBJTILES = (uint32*)0x6010000;
 	OBJTILES[(1 * 8) + 0] = ((0 << 0) | (0 << 4) | (0 << 8) | (0 << 12) | (0 << 16) | (3 << 20) | (3 << 24) | (3 << 28)); // left side of rocket
 	OBJTILES[(1 * 8) + 1] = ((0 << 0) | (0 << 4) | (0 << 8) | (0 << 12) | (1 << 16) | (1 << 20) | (3 << 24) | (3 << 28));
@@ -344,480 +290,95 @@ int main(void) {
 	OBJTILES[(37 * 8) + 6] = ((2 << 0) | (2 << 4) | (2 << 8) | (1 << 12) | (1 << 16) | (0 << 20) | (0 << 24) | (0 << 28));
 	OBJTILES[(37 * 8) + 7] = ((1 << 0) | (1 << 4) | (1 << 8) | (1 << 12) | (0 << 16) | (0 << 20) | (0 << 24) | (0 << 28));
 
-	// positional values and timers
-	short xPos = 50;
-	short yPos = 80;
-	short meteorX1 = 240;
-	short meteorX2 = 240;
-	short meteorX3 = 240;
-	short meteorX4 = 240;
-	short meteorX5 = 240;
-	short meteorX6 = 240;
-	short meteorY1 = 16;
-	short meteorY2 = 32;
-	short meteorY3 = 48;
-	short meteorY4 = 64;
-	short meteorY5 = 80;
-	short meteorY6 = 96;
-	uint16 timer1 = 0;
-	uint16 timer2 = 0;
-	uint16 timer3 = 0;
-	uint16 timer4 = 0;
-	uint16 timer5 = 0;
-	uint16 timer6 = 0;
-
-	uint16* OAM = (uint16*)0x7000000;
-	// rocket
-	OAM[(0 * 4) + 0] = ((yPos << 0) | (1 << 14)); // y | OBJ shape
-	OAM[(0 * 4) + 1] = ((xPos << 0) | (0 << 14)); // x | OBJ size
-	OAM[(0 * 4) + 2] = ((1 << 0) | (1 << 12)); // tile num | palette num
-
-	// meteor 1
-	OAM[(1 * 4) + 0] = ((meteorY1 << 0) | (0 << 14)); // y | OBJ shape
-	OAM[(1 * 4) + 1] = ((meteorX1 << 0) | (1 << 14)); // x | OBJ size
-	OAM[(1 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
-	// meteor 2
-	OAM[(2 * 4) + 0] = ((meteorY2 << 0) | (0 << 14)); // y | OBJ shape
-	OAM[(2 * 4) + 1] = ((meteorX2 << 0) | (1 << 14)); // x | OBJ size
-	OAM[(2 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
-	// meteor 3
-	OAM[(3 * 4) + 0] = ((meteorY3 << 0) | (0 << 14)); // y | OBJ shape
-	OAM[(3 * 4) + 1] = ((meteorX3 << 0) | (1 << 14)); // x | OBJ size
-	OAM[(3 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
-	// meteor 4
-	OAM[(4 * 4) + 0] = ((meteorY4 << 0) | (0 << 14)); // y | OBJ shape
-	OAM[(4 * 4) + 1] = ((meteorX4 << 0) | (1 << 14)); // x | OBJ size
-	OAM[(4 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
-	// meteor 5
-	OAM[(5 * 4) + 0] = ((meteorY5 << 0) | (0 << 14)); // y | OBJ shape
-	OAM[(5 * 4) + 1] = ((meteorX5 << 0) | (1 << 14)); // x | OBJ size
-	OAM[(5 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
-	// meteor 6
-	OAM[(6 * 4) + 0] = ((meteorY6 << 0) | (0 << 14)); // y | OBJ shape
-	OAM[(6 * 4) + 1] = ((meteorX6 << 0) | (1 << 14)); // x | OBJ size
-	OAM[(6 * 4) + 2] = ((4 << 0) | (2 << 12)); // tile num | palette num
-
-	uint16* BG1XSCROLL = (uint16*)0x4000014;
-	uint16 xScroll0 = 0;
-
-	uint16* BG2XSCROLL = (uint16*)0x4000018;
-	uint16 xScroll1 = 0;
-	bool shouldScroll = true;
-
-	Collision coll;
-	
+	gameInit(&game, rand());
+	stateCopy(&initialState, &game);
+	stateRefresh(&game);
+
 	volatile uint16* INPUT = (volatile uint16*)0x4000130; // keypad input memory
+	uint16 lastButtons = 0;
+	bool rewinding = false;
 
 	// GBA docs are here:	https://mgba-emu.github.io/gbatek/
 
+	musicStart();
 	while (1)
 	{					
-		frame++;
-		scoreTimer++;
-		timer1++;
-		timer2++;
-		timer3++;
-		timer4++;
-		timer5++;
-		timer6++;
-
-		// music loop
-		if (!gameOver)
-		{
-			if (currentFrame == 0)
-			{
-				// cycle through notes of the song
-				uint16 theNote = song[currentNote];
-				if (theNote > 0)
-				{
-					SOUND2_FREQ[0] = ((theNote << 0) | (1 << 14) | (1 << 15));
-				}
-				currentNote++;
-				currentNote %= 64;
-			}
-			// controls the speed of the song
-			currentFrame++;
-			currentFrame %= songSpeed;
-		}
-		
-		if (scoreTimer > 59)
-		{
-			score++;
-			// divide score into 5 digits for display
-			digit5 = score / 10000 % 10;
-			digit4 = score / 1000 % 10;
-			digit3 = score / 100 % 10;
-			digit2 = score / 10 % 10;
-			digit1 = score % 10;
-
-			// display score
-			if (!gameOver)
-			{
-				MAPMEM[0] = (((digit5 + 9) << 0) | (3 << 12));
-				MAPMEM[1] = (((digit4 + 9) << 0) | (3 << 12));
-				MAPMEM[2] = (((digit3 + 9) << 0) | (3 << 12));
-				MAPMEM[3] = (((digit2 + 9) << 0) | (3 << 12));
-				MAPMEM[4] = (((digit1 + 9) << 0) | (3 << 12));
-			}		
-			scoreTimer = 0;
-		}
-
-		if (frame > 1 && !gameOver) // handles background scrolling
-		{
-			BG1XSCROLL[0] = xScroll0;
-			xScroll0++;
-			if (xScroll0 > 255)
-			{
-				xScroll0 = 0;
-			}
-			BG2XSCROLL[0] = xScroll1;
-			if (shouldScroll) // bg1 scrolls every other frame for parallax effect
-			{
-				xScroll1++;
-			}
-			shouldScroll = !shouldScroll;
-			if (xScroll1 > 255)
-			{
-				xScroll1 = 0;
-			}
-		}
-
-		if (!gameOver)
-		{
-			short randomY = 1;
-			short prevY = 1;
-
-			// meteor1 y
-			if (timer1 > 119) // meteor crosses screen every 120 frames
-			{
-				prevY = randomY;
-				do
-				{
-					randomY = rand() % 9 + 1; // new y value is randomly selected every time meteor crosses screen
-				} while (randomY == prevY);
-				meteorY1 = randomY * 16;
-				OAM[(1 * 4) + 0] = ((meteorY1 << 0) | (0 << 14)); // update y position
-				timer1 = 0; // reset timer
-			}
-			// meteor1 x
-			meteorX1 = meteorX1 - 2; // meteor constantly moving from right to left
-			if (meteorX1 < 1) // once meteor reaches end of screen on left
-			{
-				meteorX1 = 240; // reset position to the right
-			}
-			OAM[(1 * 4) + 1] = ((meteorX1 << 0) | (1 << 14)); // update x position
-
-			// meteor2 y
-			if (timer2 > 139)
-			{
-				prevY = randomY;
-				do
-				{
-					randomY = rand() % 9 + 1; // new y value is randomly selected every time meteor crosses screen
-				} while (randomY == prevY);
-				meteorY2 = randomY * 16;
-				OAM[(2 * 4) + 0] = ((meteorY2 << 0) | (0 << 14)); // update y position
-				timer2 = 20;
-			}
-			// meteor2 x
-			if (timer2 > 19)
-			{
-				meteorX2 = meteorX2 - 2;
-				if (meteorX2 < 1)
-				{
-					meteorX2 = 240;
-				}
-				if (frame > 1440 + 20)
-				{
-					OAM[(2 * 4) + 1] = ((meteorX2 << 0) | (1 << 14));
-				}
-				else
-				{
-					OAM[(2 * 4) + 1] = ((240 << 0) | (1 << 14));
-				}
-			}
-
-			// meteor3 y
-			if (timer3 > 159)
-			{
-				prevY = randomY;
-				do
-				{
-					randomY = rand() % 9 + 1; // new y value is randomly selected every time meteor crosses screen
-				} while (randomY == prevY);
-				meteorY3 = randomY * 16;
-				OAM[(3 * 4) + 0] = ((meteorY3 << 0) | (0 << 14)); // update y position
-				timer3 = 40;
-			}
-			// meteor3 x
-			if (timer3 > 39)
-			{
-				meteorX3 = meteorX3 - 2;
-				if (meteorX3 < 1)
-				{
-					meteorX3 = 240;
-				}
-				if (frame > 720 + 40)
-				{
-					OAM[(3 * 4) + 1] = ((meteorX3 << 0) | (1 << 14));
-				}
-				else
-				{
-					OAM[(3 * 4) + 1] = ((240 << 0) | (1 << 14));
-				}
-			}
-
-			// meteor4 y
-			if (timer4 > 179)
-			{
-				prevY = randomY;
-				do
-				{
-					randomY = rand() % 9 + 1; // new y value is randomly selected every time meteor crosses screen
-				} while (randomY == prevY);
-				meteorY4 = randomY * 16;
-				OAM[(4 * 4) + 0] = ((meteorY4 << 0) | (0 << 14)); // update y position
-				timer4 = 60;
-			}
-			// meteor4 x
-			if (timer4 > 59)
-			{
-				meteorX4 = meteorX4 - 2;
-				if (meteorX4 < 1)
-				{
-					meteorX4 = 240;
-				}
-				if (frame < 720 + 60 || frame > 1440 + 60)
-				{
-					OAM[(4 * 4) + 1] = ((meteorX4 << 0) | (1 << 14));
-				}
-				else
-				{
-					OAM[(4 * 4) + 1] = ((240 << 0) | (1 << 14));
-				}
-			}
-
-			// meteor5 y
-			if (timer5 > 199)
-			{
-				prevY = randomY;
-				do
-				{
-					randomY = rand() % 9 + 1; // new y value is randomly selected every time meteor crosses screen
-				} while (randomY == prevY);
-				meteorY5 = randomY * 16;
-				OAM[(5 * 4) + 0] = ((meteorY5 << 0) | (0 << 14)); // update y position
-				timer5 = 80;
-			}
-			// meteor5 x
-			if (timer5 > 79)
-			{
-				meteorX5 = meteorX5 - 2;
-				if (meteorX5 < 1)
-				{
-					meteorX5 = 240;
-				}
-				if (frame > 720 + 80)
-				{
-					OAM[(5 * 4) + 1] = ((meteorX5 << 0) | (1 << 14));
-				}
-				else
-				{
-					OAM[(5 * 4) + 1] = ((240 << 0) | (1 << 14));
-				}
-			}
-
-			// meteor6 y
-			if (timer6 > 219)
-			{
-				prevY = randomY;
-				do
-				{
-					randomY = rand() % 9 + 1; // new y value is randomly selected every time meteor crosses screen
-				} while (randomY == prevY);
-				meteorY6 = randomY * 16;
-				OAM[(6 * 4) + 0] = ((meteorY6 << 0) | (0 << 14)); // update y position
-				timer6 = 100;
-			}
-			// meteor6 x
-			if (timer6 > 99)
-			{
-				meteorX6 = meteorX6 - 2;
-				if (meteorX6 < 1)
-				{
-					meteorX6 = 240;
-				}
-				if (frame > 1440 + 100)
-				{
-					OAM[(6 * 4) + 1] = ((meteorX6 << 0) | (1 << 14));
-				}
-				else
-				{
-					OAM[(6 * 4) + 1] = ((240 << 0) | (1 << 14));
-				}
-			}
-		}
-		
-		// movement
 		uint16 buttonsPressed = *INPUT;
 		buttonsPressed = (~buttonsPressed); // flipping binary to check for button press and not button release
-		srand(rand() + buttonsPressed); // initialize random seed based on player inputs
-		
-		if (!gameOver)
-		{
-			if (buttonsPressed & RIGHT)
-			{
-				xPos++;
-				if (xPos > 220)
-				{
-					xPos = 220;
-				}
-				OAM[(0 * 4) + 1] = ((xPos << 0) | (0 << 14));
-			}
-			if (buttonsPressed & LEFT)
-			{
-				xPos--;
-				if (xPos < 1)
-				{
-					xPos = 1;
-				}
-				OAM[(0 * 4) + 1] = ((xPos << 0) | (0 << 14));
-			}
-			if (buttonsPressed & UP)
-			{
-				yPos--;
-				if (yPos < 1)
-				{
-					yPos = 1;
-				}
-				OAM[(0 * 4) + 0] = ((yPos << 0) | (1 << 14));
-			}
-			if (buttonsPressed & DOWN)
-			{
-				yPos++;
-				if (yPos > 151)
-				{
-					yPos = 151;
-				}
-				OAM[(0 * 4) + 0] = ((yPos << 0) | (1 << 14));
-			}
+		uint16 buttonsDown = buttonsPressed & ~lastButtons; // buttons that have only just been pressed
+		lastButtons = buttonsPressed;
+
+		// pause, nothing runs until start is pressed again
+		if (!game.gameOver && (buttonsDown & START))
+		{
+			textPrint(12, 9, "PAUSED", 1);
+			VBlankIntrWait();
+			textFlush();
+			musicStop();
+			game.seed += powerWaitForKeys(START);
+			musicResume();
+			lastButtons |= START; // start is still held after waking up
+			textPrint(12, 9, "      ", 1);
 		}
 
-		// collision tests
-		coll.x11 = meteorX1;
-		coll.y11 = meteorY1;
-		coll.x21 = meteorX2;
-		coll.y21 = meteorY2;
-		coll.x31 = meteorX3;
-		coll.y31 = meteorY3;
-		coll.x41 = meteorX4;
-		coll.y41 = meteorY4;
-		coll.x51 = meteorX5;
-		coll.y51 = meteorY5;
-		coll.x61 = meteorX6;
-		coll.y61 = meteorY6;
-
-		collFunction(&coll); // ARM CPU THUMB Code to calculate collision boundaries
-
-		// meteor1		
-		if (xPos > coll.x11 && xPos < coll.x12 && yPos > coll.y11 && yPos < coll.y12)
-		{
-			gameOver = true;
-		}
-		// meteor2
-		if ((xPos > coll.x21 && xPos < coll.x22 && yPos > coll.y21 && yPos < coll.y22) && frame > 1440 + 20)
-		{
-			gameOver = true;
-		}
-		// meteor3
-		if ((xPos > coll.x31 && xPos < coll.x32 && yPos > coll.y31 && yPos < coll.y32) && frame > 720 + 40)
-		{
-			gameOver = true;
-		}
-		// meteor4
-		if ((xPos > coll.x41 && xPos < coll.x42 && yPos > coll.y41 && yPos < coll.y42) && (frame < 720 + 60 || frame > 1440 + 60))
-		{
-			gameOver = true;
-		}
-		// meteor5
-		if ((xPos > coll.x51 && xPos < coll.x52 && yPos > coll.y51 && yPos < coll.y52) && frame > 720 + 80)
-		{
-			gameOver = true;
-		}
-		// meteor6
-		if ((xPos > coll.x61 && xPos < coll.x62 && yPos > coll.y61 && yPos < coll.y62) && frame > 1440 + 100)
-		{
-			gameOver = true;
+		// holding b rewinds back through the last couple of seconds
+		if (!game.gameOver && (buttonsPressed & BUTTON_B))
+		{
+			if (!rewinding)
+			{
+				stateRewind(&game); // the newest snapshot is the frame already on screen, skip past it
+				rewinding = true;
+			}
+			stateRewind(&game); // once the history runs out the game stays frozen until b is let go
+			VBlankIntrWait();
+			stateRefresh(&game);
+			continue;
 		}
+		rewinding = false;
+
+		gameUpdate(&game, buttonsPressed);
 
 		// reset game
-		if (gameOver && (buttonsPressed & BUTTON_A))
-		{
-			frame = 0;
-			score = 0;
-			scoreTimer = 0;
-			timer1 = 0;
-			timer2 = 0;
-			timer3 = 0;
-			timer4 = 0;
-			timer5 = 0;
-			timer6 = 0;
-			currentNote = 0;
-			currentFrame = 0;
-			xPos = 50;
-			yPos = 80;
-			meteorX1 = 240;
-			meteorX2 = 240;
-			meteorX3 = 240;
-			meteorX4 = 240;
-			meteorX5 = 240;
-			meteorX6 = 240;
-			meteorY1 = 16;
-			meteorY2 = 32;
-			meteorY3 = 48;
-			meteorY4 = 64;
-			meteorY5 = 80;
-			meteorY6 = 96;
-			xScroll0 = 0;
-			xScroll1 = 0;
-			shouldScroll = true;
-			// rocket
-			OAM[(0 * 4) + 0] = ((yPos << 0) | (1 << 14));
-			OAM[(0 * 4) + 1] = ((xPos << 0) | (0 << 14));
-			OAM[(0 * 4) + 2] = ((1 << 0) | (1 << 12));
-			// meteor 1
-			OAM[(1 * 4) + 0] = ((meteorY1 << 0) | (0 << 14));
-			OAM[(1 * 4) + 1] = ((meteorX1 << 0) | (1 << 14));
-			OAM[(1 * 4) + 2] = ((4 << 0) | (2 << 12));
-			// meteor 2
-			OAM[(2 * 4) + 0] = ((meteorY2 << 0) | (0 << 14));
-			OAM[(2 * 4) + 1] = ((meteorX2 << 0) | (1 << 14));
-			OAM[(2 * 4) + 2] = ((4 << 0) | (2 << 12));
-			// meteor 3
-			OAM[(3 * 4) + 0] = ((meteorY3 << 0) | (0 << 14));
-			OAM[(3 * 4) + 1] = ((meteorX3 << 0) | (1 << 14));
-			OAM[(3 * 4) + 2] = ((4 << 0) | (2 << 12));
-			// meteor 4
-			OAM[(4 * 4) + 0] = ((meteorY4 << 0) | (0 << 14));
-			OAM[(4 * 4) + 1] = ((meteorX4 << 0) | (1 << 14));
-			OAM[(4 * 4) + 2] = ((4 << 0) | (2 << 12));
-			// meteor 5
-			OAM[(5 * 4) + 0] = ((meteorY5 << 0) | (0 << 14));
-			OAM[(5 * 4) + 1] = ((meteorX5 << 0) | (1 << 14));
-			OAM[(5 * 4) + 2] = ((4 << 0) | (2 << 12));
-			// meteor 6
-			OAM[(6 * 4) + 0] = ((meteorY6 << 0) | (0 << 14));
-			OAM[(6 * 4) + 1] = ((meteorX6 << 0) | (1 << 14));
-			OAM[(6 * 4) + 2] = ((4 << 0) | (2 << 12));
-			MAPMEM[0] = ((9 << 0) | (3 << 12));
-			MAPMEM[1] = ((9 << 0) | (3 << 12));
-			MAPMEM[2] = ((9 << 0) | (3 << 12));
-			MAPMEM[3] = ((9 << 0) | (3 << 12));
-			MAPMEM[4] = ((9 << 0) | (3 << 12));
-			gameOver = false;
+		if (game.gameOver)
+		{
+			int newPosition = saveAddScore(game.score);
+			musicStop();
+
+			// game over screen with the high score table, the new score is in light blue
+			textPrint(10, 3, "GAME OVER", 1);
+			textPrint(10, 6, "HIGH SCORES", 1);
+			for (int i = 0; i < HIGHSCORE_COUNT; i++)
+			{
+				uint16 palette = (i == newPosition) ? 3 : 1;
+				textPrintNumber(11, 8 + i, i + 1, 1, palette);
+				textPrint(12, 8 + i, ".", palette);
+				textPrintNumber(14, 8 + i, saveData.highScores[i], 5, palette);
+			}
+			textPrint(11, 15, "PRESS A", 1);
+
+			do // show the frame the rocket was hit on and finish writing the high score table before going to sleep
+			{
+				VBlankIntrWait();
+				stateRefresh(&game);
+				textFlush();
+			} while (saveUpdate());
+			uint32 seed = game.seed + powerWaitForKeys(BUTTON_A); // sleep until the player restarts
+			stateCopy(&game, &initialState); // back to exactly how everything was at startup
+			game.seed = seed; // carry on with new random numbers rather than replaying the first game
+			stateClearRewind();
+			intReport();
+			arenaReport();
+			textClear();
+			musicStart();
 		}
 
+		saveUpdate(); // carry on with any save in progress
+
+		stateRecord(&game);
+
 		VBlankIntrWait();
+		stateRefresh(&game); // sprites, score and scroll are only written to the hardware during vblank
+		textFlush();
 
 	}
 
@@ -0,0 +1,296 @@
+#include "text.h"
+
+// GBA docs are here:	https://mgba-emu.github.io/gbatek/
+
+static volatile uint32* const BGTILES = (volatile uint32*)0x6000000;
+static volatile uint16* const MAPMEM = (volatile uint16*)0x6004000; // bg 0 map
+
+#define MAP_WIDTH 32
+#define MAP_HEIGHT 20
+
+// 8x8 1 bit per pixel font for ascii 32 to 95, the top bit is the leftmost pixel
+static const uint8 font[64][8] = {
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // space
+	{ 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x10, 0x00 }, // !
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // "
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // #
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // $
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // %
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // &
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // (
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // )
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // *
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // +
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // ,
+	{ 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00 }, // -
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00 }, // .
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // /
+	{ 0x38, 0x44, 0x4C, 0x54, 0x64, 0x44, 0x38, 0x00 }, // 0
+	{ 0x10, 0x30, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00 }, // 1
+	{ 0x38, 0x44, 0x04, 0x08, 0x10, 0x20, 0x7C, 0x00 }, // 2
+	{ 0x78, 0x04, 0x04, 0x38, 0x04, 0x04, 0x78, 0x00 }, // 3
+	{ 0x08, 0x18, 0x28, 0x48, 0x7C, 0x08, 0x08, 0x00 }, // 4
+	{ 0x7C, 0x40, 0x78, 0x04, 0x04, 0x44, 0x38, 0x00 }, // 5
+	{ 0x18, 0x20, 0x40, 0x78, 0x44, 0x44, 0x38, 0x00 }, // 6
+	{ 0x7C, 0x04, 0x08, 0x10, 0x20, 0x20, 0x20, 0x00 }, // 7
+	{ 0x38, 0x44, 0x44, 0x38, 0x44, 0x44, 0x38, 0x00 }, // 8
+	{ 0x38, 0x44, 0x44, 0x3C, 0x04, 0x08, 0x30, 0x00 }, // 9
+	{ 0x00, 0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x00 }, // :
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // ;
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // <
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // =
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // >
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // ?
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // @
+	{ 0x38, 0x44, 0x44, 0x7C, 0x44, 0x44, 0x44, 0x00 }, // A
+	{ 0x78, 0x44, 0x44, 0x78, 0x44, 0x44, 0x78, 0x00 }, // B
+	{ 0x38, 0x44, 0x40, 0x40, 0x40, 0x44, 0x38, 0x00 }, // C
+	{ 0x70, 0x48, 0x44, 0x44, 0x44, 0x48, 0x70, 0x00 }, // D
+	{ 0x7C, 0x40, 0x40, 0x78, 0x40, 0x40, 0x7C, 0x00 }, // E
+	{ 0x7C, 0x40, 0x40, 0x78, 0x40, 0x40, 0x40, 0x00 }, // F
+	{ 0x38, 0x44, 0x40, 0x5C, 0x44, 0x44, 0x3C, 0x00 }, // G
+	{ 0x44, 0x44, 0x44, 0x7C, 0x44, 0x44, 0x44, 0x00 }, // H
+	{ 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00 }, // I
+	{ 0x1C, 0x08, 0x08, 0x08, 0x08, 0x48, 0x30, 0x00 }, // J
+	{ 0x44, 0x48, 0x50, 0x60, 0x50, 0x48, 0x44, 0x00 }, // K
+	{ 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x00 }, // L
+	{ 0x44, 0x6C, 0x54, 0x54, 0x44, 0x44, 0x44, 0x00 }, // M
+	{ 0x44, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x44, 0x00 }, // N
+	{ 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00 }, // O
+	{ 0x78, 0x44, 0x44, 0x78, 0x40, 0x40, 0x40, 0x00 }, // P
+	{ 0x38, 0x44, 0x44, 0x44, 0x54, 0x48, 0x34, 0x00 }, // Q
+	{ 0x78, 0x44, 0x44, 0x78, 0x50, 0x48, 0x44, 0x00 }, // R
+	{ 0x3C, 0x40, 0x40, 0x38, 0x04, 0x04, 0x78, 0x00 }, // S
+	{ 0x7C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00 }, // T
+	{ 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00 }, // U
+	{ 0x44, 0x44, 0x44, 0x44, 0x44, 0x28, 0x10, 0x00 }, // V
+	{ 0x44, 0x44, 0x44, 0x54, 0x54, 0x54, 0x28, 0x00 }, // W
+	{ 0x44, 0x44, 0x28, 0x10, 0x28, 0x44, 0x44, 0x00 }, // X
+	{ 0x44, 0x44, 0x28, 0x10, 0x10, 0x10, 0x10, 0x00 }, // Y
+	{ 0x7C, 0x04, 0x08, 0x10, 0x20, 0x40, 0x7C, 0x00 }, // Z
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // [
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // backslash
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // ]
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // ^
+	{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // _
+};
+
+static const uint32 powersOfTen[10] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+static uint16 textMap[MAP_WIDTH * MAP_HEIGHT]; // what the text part of the map should look like
+
+// changed part of each row, only rows with their bit set in dirtyRows need writing out
+static uint32 dirtyRows = 0;
+static uint8 dirtyStart[MAP_HEIGHT];
+static uint8 dirtyEnd[MAP_HEIGHT];
+
+// glyph cache. a slot can only be reused once no map entry refers to it,
+// and out of those the least recently used one goes first
+static char slotGlyph[TEXT_CACHE_SIZE];
+static uint16 slotRefs[TEXT_CACHE_SIZE];
+static uint16 slotLastUse[TEXT_CACHE_SIZE];
+static uint16 useClock = 0;
+
+static void uploadGlyph(uint16 slot, char c)
+{
+	const uint8* rows = font[c - 32];
+	uint16 row;
+	uint16 px;
+
+	// expand each 1 bit row to 8 4 bit pixels
+	for (row = 0; row < 8; row++)
+	{
+		uint32 pixels = 0;
+		for (px = 0; px < 8; px++)
+		{
+			if (rows[row] & (0x80 >> px))
+			{
+				pixels |= (TEXT_COLOUR << (px * 4));
+			}
+		}
+		BGTILES[((TEXT_FIRST_TILE + slot) * 8) + row] = pixels;
+	}
+}
+
+// returns the cache slot holding the glyph, loading it on a miss. -1 if every slot is on screen
+static int findSlot(char c)
+{
+	int victim = -1;
+	int i;
+
+	useClock++;
+	for (i = 0; i < TEXT_CACHE_SIZE; i++)
+	{
+		if (slotGlyph[i] == c)
+		{
+			slotLastUse[i] = useClock;
+			return i;
+		}
+	}
+
+	for (i = 0; i < TEXT_CACHE_SIZE; i++)
+	{
+		if (slotRefs[i] == 0 && (victim < 0 || (uint16)(useClock - slotLastUse[i]) > (uint16)(useClock - slotLastUse[victim])))
+		{
+			victim = i;
+		}
+	}
+	if (victim < 0)
+	{
+		return -1;
+	}
+
+	uploadGlyph(victim, c);
+	slotGlyph[victim] = c;
+	slotLastUse[victim] = useClock;
+	return victim;
+}
+
+static void markDirty(uint16 x, uint16 y)
+{
+	if (!(dirtyRows & (1 << y)))
+	{
+		dirtyRows |= (1 << y);
+		dirtyStart[y] = x;
+		dirtyEnd[y] = x;
+	}
+	else if (x < dirtyStart[y])
+	{
+		dirtyStart[y] = x;
+	}
+	else if (x > dirtyEnd[y])
+	{
+		dirtyEnd[y] = x;
+	}
+}
+
+static void setCell(uint16 x, uint16 y, char c, uint16 palette)
+{
+	uint16 cell = (y * MAP_WIDTH) + x;
+	uint16 old = textMap[cell];
+	uint16 oldTile = old & 0x3FF;
+	uint16 entry = 0;
+	int slot;
+
+	if (c >= 'a' && c <= 'z')
+	{
+		c -= 32;
+	}
+	if (c <= ' ' || c > '_')
+	{
+		c = ' ';
+	}
+
+	// same as last time, nothing to do
+	if (c == ' ' ? old == 0 : (oldTile >= TEXT_FIRST_TILE && slotGlyph[oldTile - TEXT_FIRST_TILE] == c && (old >> 12) == palette))
+	{
+		return;
+	}
+
+	if (c != ' ')
+	{
+		slot = findSlot(c);
+		if (slot < 0)
+		{
+			return;
+		}
+		slotRefs[slot]++;
+		entry = (((TEXT_FIRST_TILE + slot) << 0) | (palette << 12)); // tile num | pal num
+	}
+	if (oldTile >= TEXT_FIRST_TILE)
+	{
+		slotRefs[oldTile - TEXT_FIRST_TILE]--;
+	}
+
+	textMap[cell] = entry;
+	markDirty(x, y);
+}
+
+void textInit(void)
+{
+	uint16 i;
+
+	for (i = 0; i < MAP_WIDTH * MAP_HEIGHT; i++)
+	{
+		textMap[i] = 0;
+	}
+	for (i = 0; i < TEXT_CACHE_SIZE; i++)
+	{
+		slotGlyph[i] = 0;
+		slotRefs[i] = 0;
+		slotLastUse[i] = 0;
+	}
+	dirtyRows = 0;
+}
+
+void textPrint(uint16 x, uint16 y, const char* text, uint16 palette)
+{
+	while (*text && x < MAP_WIDTH)
+	{
+		setCell(x, y, *text, palette);
+		text++;
+		x++;
+	}
+}
+
+void textPrintNumber(uint16 x, uint16 y, uint32 value, uint16 digits, uint16 palette)
+{
+	char text[11];
+	uint16 i;
+
+	if (digits > 10)
+	{
+		digits = 10;
+	}
+	// counting down each power of ten instead of dividing
+	for (i = 0; i < digits; i++)
+	{
+		uint32 power = powersOfTen[digits - 1 - i];
+		char digit = '0';
+		while (value >= power)
+		{
+			value -= power;
+			digit++;
+		}
+		text[i] = digit > '9' ? '9' : digit;
+	}
+	text[i] = 0;
+
+	textPrint(x, y, text, palette);
+}
+
+void textClear(void)
+{
+	uint16 x;
+	uint16 y;
+
+	for (y = 0; y < MAP_HEIGHT; y++)
+	{
+		for (x = 0; x < MAP_WIDTH; x++)
+		{
+			if (textMap[(y * MAP_WIDTH) + x])
+			{
+				setCell(x, y, ' ', 0);
+			}
+		}
+	}
+}
+
+void textFlush(void)
+{
+	uint16 y;
+	uint16 x;
+
+	for (y = 0; dirtyRows; y++)
+	{
+		if (dirtyRows & (1 << y))
+		{
+			for (x = dirtyStart[y]; x <= dirtyEnd[y]; x++)
+			{
+				MAPMEM[(y * MAP_WIDTH) + x] = textMap[(y * MAP_WIDTH) + x];
+			}
+			dirtyRows &= ~(1 << y);
+		}
+	}
+}
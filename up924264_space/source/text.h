@@ -0,0 +1,18 @@
+#ifndef TEXT_H
+#define TEXT_H
+
+#include "types.h"
+
+// text is drawn on bg 0. glyphs are copied from the rom font into a small cache of
+// bg tiles the first time they're needed, so only the characters on screen use vram
+#define TEXT_FIRST_TILE 32 // bg tiles 32 to 63 hold the cached glyphs
+#define TEXT_CACHE_SIZE 32
+#define TEXT_COLOUR 1 // palette colour the glyph pixels are drawn in
+
+void textInit(void);
+void textPrint(uint16 x, uint16 y, const char* text, uint16 palette); // x and y are in tiles
+void textPrintNumber(uint16 x, uint16 y, uint32 value, uint16 digits, uint16 palette); // zero padded
+void textClear(void); // blanks everything that has been printed
+void textFlush(void); // writes the changed parts of the map, call during vblank
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef TYPES_H
+#define TYPES_H
+
+typedef unsigned int uint32;
+typedef unsigned short uint16;
+typedef unsigned char uint8;
+
+#endif
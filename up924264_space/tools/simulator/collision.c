@@ -0,0 +1,21 @@
+// C version of collFunction from source/myasm.s, which is THUMB code and can't run natively.
+// works out the boundaries of every meteor the same way: 16 left and right, 8 above and 16 below
+
+typedef unsigned short uint16;
+
+void collFunction(void* c)
+{
+	uint16* coll = (uint16*)c;
+	int i;
+
+	for (i = 0; i < 6; i++)
+	{
+		uint16* lower = &coll[i * 2]; // x11, y11, x21, y21 ...
+		uint16* upper = &coll[12 + (i * 2)]; // x12, y12, x22, y22 ...
+
+		lower[0] -= 16;
+		upper[0] = lower[0] + 32;
+		lower[1] -= 8;
+		upper[1] = lower[1] + 24;
+	}
+}
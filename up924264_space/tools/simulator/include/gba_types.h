@@ -0,0 +1,8 @@
+// stand in for libgba's gba_types.h so the gameplay code builds natively,
+// the simulator only needs bool from it
+#ifndef _gba_types_h_
+#define _gba_types_h_
+
+#include <stdbool.h>
+
+#endif
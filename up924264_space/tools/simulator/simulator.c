@@ -0,0 +1,523 @@
+// plays huge numbers of games of up924264_space with a bot at the controls, using the real
+// gameUpdate() from source/game.c, and reports how long the bot survives and how busy the
+// screen is over time. used for tuning the meteor timings in game.c
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "game.h"
+
+#define FPS 60
+#define CHUNK 64 // games a worker takes at a time
+#define MAX_SCRIPT 1024
+#define MAX_THREADS 256
+
+typedef enum Bot { BOT_IDLE, BOT_RANDOM, BOT_DODGE, BOT_SCRIPT } Bot;
+
+typedef struct ScriptStep
+{
+	uint32 frames;
+	uint16 buttons;
+} ScriptStep;
+
+typedef struct Options
+{
+	uint64_t games;
+	uint32 maxFrames;
+	uint32 seed;
+	int threads;
+	Bot bot;
+	ScriptStep script[MAX_SCRIPT];
+	int scriptLength;
+	uint32 scriptFrames;
+} Options;
+
+typedef struct Stats
+{
+	uint64_t* deaths; // games that ended on each frame
+	uint64_t* hazards; // hazards on screen on each frame, added up over every game still going
+	uint64_t* alive; // games still going on each frame
+	uint64_t survivors; // games that reached maxFrames
+	uint64_t totalFrames;
+} Stats;
+
+// every worker owns a range of game numbers. it takes CHUNK games at a time from the front,
+// and when it runs dry it steals the back half of another worker's range
+typedef struct Worker
+{
+	pthread_mutex_t lock;
+	uint64_t next;
+	uint64_t end;
+	pthread_t thread;
+	int id;
+	Stats stats;
+} Worker;
+
+static Options options;
+static Worker* workers;
+
+static uint64_t splitmix(uint64_t x)
+{
+	x += 0x9E3779B97F4A7C15ull;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	return x ^ (x >> 31);
+}
+
+static int hazardsOnScreen(const GameState* game)
+{
+	int count = 0;
+	int i;
+
+	// meteors that haven't been let out yet are parked at x 240
+	for (i = 1; i <= 6; i++)
+	{
+		if ((game->oam[(i * 4) + 1] & 0x1FF) < 240)
+		{
+			count++;
+		}
+	}
+	for (i = 0; i < HOMING_COUNT; i++)
+	{
+		count += game->homing[i].active;
+	}
+	return count;
+}
+
+// moves away from anything heading for the rocket, otherwise drifts back to the start position
+static uint16 dodge(const GameState* game)
+{
+	short hazardX[6 + HOMING_COUNT];
+	short hazardY[6 + HOMING_COUNT];
+	int count = 0;
+	int threat = 0;
+	int i;
+
+	for (i = 1; i <= 6; i++)
+	{
+		if ((game->oam[(i * 4) + 1] & 0x1FF) < 240)
+		{
+			hazardX[count] = game->oam[(i * 4) + 1] & 0x1FF;
+			hazardY[count] = game->oam[(i * 4) + 0] & 0xFF;
+			count++;
+		}
+	}
+	for (i = 0; i < HOMING_COUNT; i++)
+	{
+		if (game->homing[i].active)
+		{
+			hazardX[count] = FIX_TO_INT(game->homing[i].x);
+			hazardY[count] = FIX_TO_INT(game->homing[i].y);
+			count++;
+		}
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		int dx = hazardX[i] - game->xPos;
+		int dy = hazardY[i] - game->yPos;
+		if (dx > -20 && dx < 56 && dy > -22 && dy < 22)
+		{
+			threat += (dy <= 0) ? 1 : -1; // positive when the danger is above
+		}
+	}
+
+	if (threat > 0 || (threat == 0 && count && game->yPos < 24))
+	{
+		return DOWN;
+	}
+	if (threat < 0)
+	{
+		return UP;
+	}
+	if (game->yPos < 78)
+	{
+		return DOWN;
+	}
+	if (game->yPos > 82)
+	{
+		return UP;
+	}
+	return game->xPos < 50 ? RIGHT : (game->xPos > 50 ? LEFT : 0);
+}
+
+static uint16 botInput(const GameState* game, uint64_t* random, uint16* held, uint32* holdFrames)
+{
+	uint32 frame;
+	int i;
+
+	switch (options.bot)
+	{
+	case BOT_IDLE:
+		return 0;
+	case BOT_RANDOM:
+		// mashes a random direction for a random length of time
+		if (*holdFrames == 0)
+		{
+			*random = splitmix(*random);
+			*held = (uint16)((RIGHT << (*random & 3)) & (RIGHT | LEFT | UP | DOWN));
+			*holdFrames = 4 + ((*random >> 8) & 31);
+		}
+		(*holdFrames)--;
+		return *held;
+	case BOT_DODGE:
+		return dodge(game);
+	case BOT_SCRIPT:
+		frame = game->frame % options.scriptFrames; // frames already played, gameUpdate() hasn't counted this one yet
+		for (i = 0; i < options.scriptLength; i++)
+		{
+			if (frame < options.script[i].frames)
+			{
+				return options.script[i].buttons;
+			}
+			frame -= options.script[i].frames;
+		}
+		return 0;
+	}
+	return 0;
+}
+
+static void playGame(uint64_t number, Stats* stats)
+{
+	GameState game;
+	uint64_t random = splitmix(options.seed ^ splitmix(number));
+	uint16 held = 0;
+	uint32 holdFrames = 0;
+	uint32 frame;
+
+	memset(&game, 0, sizeof(game));
+	gameInit(&game, (uint32)random);
+
+	for (frame = 0; frame < options.maxFrames; frame++)
+	{
+		gameUpdate(&game, botInput(&game, &random, &held, &holdFrames));
+		stats->alive[frame]++;
+		stats->hazards[frame] += hazardsOnScreen(&game);
+		if (game.gameOver)
+		{
+			stats->deaths[frame]++;
+			stats->totalFrames += frame + 1;
+			return;
+		}
+	}
+	stats->survivors++;
+	stats->totalFrames += options.maxFrames;
+}
+
+static int takeGames(Worker* worker, uint64_t* first, uint64_t* last)
+{
+	int found = 0;
+
+	pthread_mutex_lock(&worker->lock);
+	if (worker->next < worker->end)
+	{
+		*first = worker->next;
+		worker->next = (worker->end - worker->next > CHUNK) ? worker->next + CHUNK : worker->end;
+		*last = worker->next;
+		found = 1;
+	}
+	pthread_mutex_unlock(&worker->lock);
+	return found;
+}
+
+static int stealGames(Worker* thief)
+{
+	int i;
+
+	for (i = 1; i < options.threads; i++)
+	{
+		Worker* victim = &workers[(thief->id + i) % options.threads];
+		uint64_t first = 0;
+		uint64_t last = 0;
+
+		pthread_mutex_lock(&victim->lock);
+		if (victim->next < victim->end)
+		{
+			uint64_t remaining = victim->end - victim->next;
+			last = victim->end;
+			first = (remaining > CHUNK) ? victim->end - (remaining / 2) : victim->next;
+			victim->end = first;
+		}
+		pthread_mutex_unlock(&victim->lock);
+
+		if (first < last)
+		{
+			pthread_mutex_lock(&thief->lock);
+			thief->next = first;
+			thief->end = last;
+			pthread_mutex_unlock(&thief->lock);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static void* workerMain(void* arg)
+{
+	Worker* worker = arg;
+	uint64_t first;
+	uint64_t last;
+
+	do
+	{
+		while (takeGames(worker, &first, &last))
+		{
+			for (; first < last; first++)
+			{
+				playGame(first, &worker->stats);
+			}
+		}
+	} while (stealGames(worker));
+
+	return 0;
+}
+
+static uint16 parseButtons(const char* text)
+{
+	uint16 buttons = 0;
+
+	for (; *text; text++)
+	{
+		switch (*text)
+		{
+		case 'U': buttons |= UP; break;
+		case 'D': buttons |= DOWN; break;
+		case 'L': buttons |= LEFT; break;
+		case 'R': buttons |= RIGHT; break;
+		case 'A': buttons |= BUTTON_A; break;
+		case 'B': buttons |= BUTTON_B; break;
+		}
+	}
+	return buttons;
+}
+
+// a script is lines of "<frames> <buttons>", e.g. "30 UR", played on a loop. "-" means no buttons
+static int loadScript(const char* path)
+{
+	FILE* file = fopen(path, "r");
+	char line[256];
+	char buttons[64];
+	unsigned frames;
+
+	if (!file)
+	{
+		perror(path);
+		return 0;
+	}
+	while (fgets(line, sizeof(line), file) && options.scriptLength < MAX_SCRIPT)
+	{
+		if (line[0] == '#' || sscanf(line, "%u %63s", &frames, buttons) != 2 || frames == 0)
+		{
+			continue;
+		}
+		options.script[options.scriptLength].frames = frames;
+		options.script[options.scriptLength].buttons = parseButtons(buttons);
+		options.scriptFrames += frames;
+		options.scriptLength++;
+	}
+	fclose(file);
+
+	if (options.scriptLength == 0)
+	{
+		fprintf(stderr, "%s: no steps in script\n", path);
+		return 0;
+	}
+	return 1;
+}
+
+static void usage(const char* name)
+{
+	fprintf(stderr,
+		"usage: %s [-n games] [-t threads] [-s seed] [-m max seconds] [-b idle|random|dodge|script] [-f script file]\n"
+		"  -n  games to play (default 200000)\n"
+		"  -t  worker threads (default: every core)\n"
+		"  -s  base seed, the same seed always gives the same results (default 1)\n"
+		"  -m  stop a game that survives this long (default 600)\n"
+		"  -b  who is playing (default dodge)\n"
+		"  -f  script for -b script, lines of \"<frames> <buttons>\" using U D L R A B, looped\n",
+		name);
+}
+
+static uint32 percentile(const uint64_t* deaths, uint64_t games, double fraction)
+{
+	uint64_t target = (uint64_t)(games * fraction);
+	uint64_t seen = 0;
+	uint32 frame;
+
+	for (frame = 0; frame < options.maxFrames; frame++)
+	{
+		seen += deaths[frame];
+		if (seen > target)
+		{
+			return frame + 1;
+		}
+	}
+	return options.maxFrames;
+}
+
+static void report(const Stats* total, double seconds)
+{
+	const uint32 bucket = 10 * FPS;
+	uint64_t peak = 0;
+	uint32 start;
+	uint32 frame;
+
+	printf("%llu games, %.2f seconds, %.0f games/s, %.1fM frames/s\n\n",
+		(unsigned long long)options.games, seconds, options.games / seconds, total->totalFrames / seconds / 1e6);
+
+	printf("survival time (seconds)\n");
+	printf("  mean %.1f   p10 %.1f   p50 %.1f   p90 %.1f   p99 %.1f\n",
+		(double)total->totalFrames / options.games / FPS,
+		(double)percentile(total->deaths, options.games, 0.10) / FPS,
+		(double)percentile(total->deaths, options.games, 0.50) / FPS,
+		(double)percentile(total->deaths, options.games, 0.90) / FPS,
+		(double)percentile(total->deaths, options.games, 0.99) / FPS);
+	printf("  %.2f%% survived the full %u seconds\n\n", 100.0 * total->survivors / options.games, options.maxFrames / FPS);
+
+	for (start = 0; start < options.maxFrames; start += bucket)
+	{
+		uint64_t deaths = 0;
+		for (frame = start; frame < start + bucket && frame < options.maxFrames; frame++)
+		{
+			deaths += total->deaths[frame];
+		}
+		if (deaths > peak)
+		{
+			peak = deaths;
+		}
+	}
+
+	printf("   time   alive  died here  death rate  hazards on screen\n");
+	for (start = 0; start < options.maxFrames && total->alive[start]; start += bucket)
+	{
+		uint64_t deaths = 0;
+		uint64_t hazards = 0;
+		uint64_t aliveFrames = 0;
+		char bar[41];
+		int length;
+
+		for (frame = start; frame < start + bucket && frame < options.maxFrames; frame++)
+		{
+			deaths += total->deaths[frame];
+			hazards += total->hazards[frame];
+			aliveFrames += total->alive[frame];
+		}
+		length = peak ? (int)(40 * deaths / peak) : 0;
+		memset(bar, '#', length);
+		bar[length] = 0;
+
+		printf("  %3u-%-3u %6.2f%%  %8llu  %9.2f%%  %6.2f  %s\n",
+			start / FPS, (start + bucket) / FPS,
+			100.0 * total->alive[start] / options.games,
+			(unsigned long long)deaths,
+			100.0 * deaths / total->alive[start],
+			aliveFrames ? (double)hazards / aliveFrames : 0.0,
+			bar);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const char* scriptPath = 0;
+	struct timespec started;
+	struct timespec finished;
+	Stats total;
+	uint64_t share;
+	int opt;
+	int i;
+	uint32 frame;
+
+	options.games = 200000;
+	options.maxFrames = 600 * FPS;
+	options.seed = 1;
+	options.threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	options.bot = BOT_DODGE;
+
+	while ((opt = getopt(argc, argv, "n:t:s:m:b:f:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 'n': options.games = strtoull(optarg, 0, 10); break;
+		case 't': options.threads = atoi(optarg); break;
+		case 's': options.seed = (uint32)strtoul(optarg, 0, 0); break;
+		case 'm': options.maxFrames = (uint32)atoi(optarg) * FPS; break;
+		case 'f': scriptPath = optarg; break;
+		case 'b':
+			if (!strcmp(optarg, "idle")) options.bot = BOT_IDLE;
+			else if (!strcmp(optarg, "random")) options.bot = BOT_RANDOM;
+			else if (!strcmp(optarg, "dodge")) options.bot = BOT_DODGE;
+			else if (!strcmp(optarg, "script")) options.bot = BOT_SCRIPT;
+			else { usage(argv[0]); return 1; }
+			break;
+		default:
+			usage(argv[0]);
+			return opt == 'h' ? 0 : 1;
+		}
+	}
+	if (options.threads < 1)
+	{
+		options.threads = 1;
+	}
+	if (options.threads > MAX_THREADS)
+	{
+		options.threads = MAX_THREADS;
+	}
+	if (options.games == 0 || options.maxFrames == 0)
+	{
+		usage(argv[0]);
+		return 1;
+	}
+	if (options.bot == BOT_SCRIPT && (!scriptPath || !loadScript(scriptPath)))
+	{
+		usage(argv[0]);
+		return 1;
+	}
+
+	workers = calloc(options.threads, sizeof(Worker));
+	share = options.games / options.threads;
+	for (i = 0; i < options.threads; i++)
+	{
+		Worker* worker = &workers[i];
+		worker->id = i;
+		worker->next = share * i;
+		worker->end = (i == options.threads - 1) ? options.games : share * (i + 1);
+		worker->stats.deaths = calloc(options.maxFrames, sizeof(uint64_t));
+		worker->stats.hazards = calloc(options.maxFrames, sizeof(uint64_t));
+		worker->stats.alive = calloc(options.maxFrames, sizeof(uint64_t));
+		pthread_mutex_init(&worker->lock, 0);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &started);
+	for (i = 0; i < options.threads; i++)
+	{
+		pthread_create(&workers[i].thread, 0, workerMain, &workers[i]);
+	}
+
+	memset(&total, 0, sizeof(total));
+	total.deaths = calloc(options.maxFrames, sizeof(uint64_t));
+	total.hazards = calloc(options.maxFrames, sizeof(uint64_t));
+	total.alive = calloc(options.maxFrames, sizeof(uint64_t));
+	for (i = 0; i < options.threads; i++)
+	{
+		Stats* stats = &workers[i].stats;
+		pthread_join(workers[i].thread, 0);
+		for (frame = 0; frame < options.maxFrames; frame++)
+		{
+			total.deaths[frame] += stats->deaths[frame];
+			total.hazards[frame] += stats->hazards[frame];
+			total.alive[frame] += stats->alive[frame];
+		}
+		total.survivors += stats->survivors;
+		total.totalFrames += stats->totalFrames;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &finished);
+
+	printf("bot %s, %d threads, seed %u\n", (const char*[]){ "idle", "random", "dodge", "script" }[options.bot], options.threads, options.seed);
+	report(&total, (finished.tv_sec - started.tv_sec) + (finished.tv_nsec - started.tv_nsec) / 1e9);
+	return 0;
+}